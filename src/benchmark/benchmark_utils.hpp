@@ -0,0 +1,35 @@
+#pragma once
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// returns the type string (e.g., "int") of a column data type (e.g., int32_t)
+template <typename T>
+std::string data_type_name() {
+  std::string name;
+  hana::for_each(column_types, [&](auto x) {
+    if (hana::second(x) == hana::type_c<T>) name = hana::first(x);
+  });
+  return name;
+}
+
+// generates a deterministic value of type T, with roughly distinct_values different values
+template <typename T>
+T generate_value(const size_t i, const size_t distinct_values = 1000) {
+  const auto n = i * 7919 % distinct_values;
+  if constexpr (std::is_same<T, std::string>::value) {
+    return "value_" + std::to_string(n);
+  } else {
+    return static_cast<T>(n);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+// Creates a column from a type string, as Table::create_new_chunk does for every column
+void BM_MakeSharedByColumnType(benchmark::State& state, const std::string& type) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BM_MakeSharedByColumnType, int, std::string{"int"});
+BENCHMARK_CAPTURE(BM_MakeSharedByColumnType, long, std::string{"long"});
+BENCHMARK_CAPTURE(BM_MakeSharedByColumnType, float, std::string{"float"});
+BENCHMARK_CAPTURE(BM_MakeSharedByColumnType, double, std::string{"double"});
+BENCHMARK_CAPTURE(BM_MakeSharedByColumnType, string, std::string{"string"});
+
+}  // namespace opossum
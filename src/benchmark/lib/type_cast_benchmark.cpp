@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+// The former implementation of type_cast, which converted through streams, as a baseline
+template <typename T>
+T lexical_type_cast(const AllTypeVariant& value) {
+  if (value.which() == detail::variant_index_of<T>()) return get<T>(value);
+  if constexpr (std::is_integral_v<T>) {
+    try {
+      return boost::lexical_cast<T>(value);
+    } catch (...) {
+      return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+    }
+  } else {
+    return boost::lexical_cast<T>(value);
+  }
+}
+
+// Casts the given variant to T. The variant either holds a T already or has to be converted.
+template <typename T>
+void BM_TypeCast(benchmark::State& state, const AllTypeVariant variant) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(type_cast<T>(variant));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T>
+void BM_LexicalTypeCast(benchmark::State& state, const AllTypeVariant variant) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lexical_type_cast<T>(variant));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// BENCHMARK_CAPTURE does not accept template arguments, so every target type gets its own entry point
+void BM_TypeCastToInt(benchmark::State& state, const AllTypeVariant variant) { BM_TypeCast<int32_t>(state, variant); }
+void BM_TypeCastToLong(benchmark::State& state, const AllTypeVariant variant) { BM_TypeCast<int64_t>(state, variant); }
+void BM_TypeCastToFloat(benchmark::State& state, const AllTypeVariant variant) { BM_TypeCast<float>(state, variant); }
+void BM_TypeCastToDouble(benchmark::State& state, const AllTypeVariant variant) { BM_TypeCast<double>(state, variant); }
+void BM_TypeCastToString(benchmark::State& state, const AllTypeVariant variant) {
+  BM_TypeCast<std::string>(state, variant);
+}
+void BM_LexicalTypeCastToInt(benchmark::State& state, const AllTypeVariant variant) {
+  BM_LexicalTypeCast<int32_t>(state, variant);
+}
+void BM_LexicalTypeCastToDouble(benchmark::State& state, const AllTypeVariant variant) {
+  BM_LexicalTypeCast<double>(state, variant);
+}
+void BM_LexicalTypeCastToString(benchmark::State& state, const AllTypeVariant variant) {
+  BM_LexicalTypeCast<std::string>(state, variant);
+}
+
+BENCHMARK_CAPTURE(BM_TypeCastToInt, int_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_TypeCastToInt, int_from_long, AllTypeVariant{int64_t{123456}});
+BENCHMARK_CAPTURE(BM_TypeCastToInt, int_from_double, AllTypeVariant{123456.7});
+BENCHMARK_CAPTURE(BM_TypeCastToInt, int_from_string, AllTypeVariant{std::string{"123456"}});
+BENCHMARK_CAPTURE(BM_TypeCastToLong, long_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_TypeCastToDouble, double_from_double, AllTypeVariant{123456.7});
+BENCHMARK_CAPTURE(BM_TypeCastToDouble, double_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_TypeCastToDouble, double_from_string, AllTypeVariant{std::string{"123456.7"}});
+BENCHMARK_CAPTURE(BM_TypeCastToFloat, float_from_double, AllTypeVariant{123456.7});
+BENCHMARK_CAPTURE(BM_TypeCastToString, string_from_string, AllTypeVariant{std::string{"123456"}});
+BENCHMARK_CAPTURE(BM_TypeCastToString, string_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_TypeCastToString, string_from_double, AllTypeVariant{123456.7});
+
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToInt, int_from_long, AllTypeVariant{int64_t{123456}});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToInt, int_from_double, AllTypeVariant{123456.7});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToInt, int_from_string, AllTypeVariant{std::string{"123456"}});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToDouble, double_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToDouble, double_from_string, AllTypeVariant{std::string{"123456.7"}});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToString, string_from_int, AllTypeVariant{int32_t{123456}});
+BENCHMARK_CAPTURE(BM_LexicalTypeCastToString, string_from_double, AllTypeVariant{123456.7});
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.hpp"
+#include "operators/aggregate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Computes SUM and COUNT of an int column grouped by one or two columns of type T with state.range(1) groups each,
+// optionally on dictionary-compressed chunks
+template <typename T>
+void BM_Aggregate(benchmark::State& state, const size_t group_by_column_count, const bool compress) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto distinct_values = static_cast<size_t>(state.range(1));
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", data_type_name<T>());
+  table->add_column("b", data_type_name<T>());
+  table->add_column("c", "int");
+  for (size_t i = 0; i < row_count; ++i) {
+    table->append({generate_value<T>(i, distinct_values), generate_value<T>(i / 3, distinct_values),
+                   static_cast<int32_t>(i)});
+  }
+  if (compress) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  }
+
+  auto group_by_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  group_by_column_ids.resize(group_by_column_count);
+  const auto aggregate = Aggregate{
+      table, {{ColumnID{2}, AggregateFunction::Sum}, {ColumnID{2}, AggregateFunction::Count}}, group_by_column_ids};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(aggregate.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+void BM_AggregateIntKey(benchmark::State& state) { BM_Aggregate<int32_t>(state, 1, false); }
+void BM_AggregateIntKeyDictionary(benchmark::State& state) { BM_Aggregate<int32_t>(state, 1, true); }
+void BM_AggregateCompositeIntKey(benchmark::State& state) { BM_Aggregate<int32_t>(state, 2, false); }
+void BM_AggregateStringKey(benchmark::State& state) { BM_Aggregate<std::string>(state, 1, false); }
+void BM_AggregateCompositeStringKey(benchmark::State& state) { BM_Aggregate<std::string>(state, 2, false); }
+
+BENCHMARK(BM_AggregateIntKey)->ArgsProduct({{1 << 20}, {16, 1 << 12}});
+BENCHMARK(BM_AggregateIntKeyDictionary)->ArgsProduct({{1 << 20}, {16, 1 << 12}});
+BENCHMARK(BM_AggregateCompositeIntKey)->ArgsProduct({{1 << 20}, {16, 1 << 12}});
+BENCHMARK(BM_AggregateStringKey)->ArgsProduct({{1 << 20}, {16, 1 << 12}});
+BENCHMARK(BM_AggregateCompositeStringKey)->ArgsProduct({{1 << 20}, {16, 1 << 12}});
+
+}  // namespace opossum
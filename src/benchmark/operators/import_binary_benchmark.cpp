@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "../benchmark_utils.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Loads a table with an int and a string column from a binary file, optionally with dictionary-compressed chunks
+void BM_ImportBinary(benchmark::State& state, const bool compress) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto filename = std::string{"import_binary_benchmark.bin"};
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (size_t i = 0; i < row_count; ++i) {
+    table->append({generate_value<int32_t>(i), generate_value<std::string>(i)});
+  }
+  if (compress) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  }
+  ExportBinary{table, filename}.execute();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ImportBinary{filename}.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+
+  std::remove(filename.c_str());
+}
+
+void BM_ImportBinaryValue(benchmark::State& state) { BM_ImportBinary(state, false); }
+void BM_ImportBinaryDictionary(benchmark::State& state) { BM_ImportBinary(state, true); }
+
+BENCHMARK(BM_ImportBinaryValue)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_ImportBinaryDictionary)->Range(1 << 16, 1 << 20);
+
+}  // namespace opossum
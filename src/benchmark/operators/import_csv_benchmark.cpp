@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../benchmark_utils.hpp"
+#include "operators/import_csv.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+// Imports a CSV file with an int, a double, and a string column, optionally parsing its blocks in parallel
+void BM_ImportCsv(benchmark::State& state, const bool use_scheduler) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto filename = std::string{"import_csv_benchmark.csv"};
+  {
+    std::ofstream file{filename};
+    file << "a,b,c\nint,double,string\n";
+    for (size_t i = 0; i < row_count; ++i) {
+      file << generate_value<int32_t>(i) << ',' << generate_value<double>(i) / 7 << ',' << generate_value<std::string>(i)
+           << '\n';
+    }
+  }
+  if (use_scheduler) CurrentScheduler::set(std::make_shared<TaskScheduler>());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ImportCsv{filename, "table", 1 << 16}.execute());
+    StorageManager::reset();
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+
+  CurrentScheduler::set(nullptr);
+  std::remove(filename.c_str());
+}
+
+void BM_ImportCsvSingleThreaded(benchmark::State& state) { BM_ImportCsv(state, false); }
+void BM_ImportCsvParallel(benchmark::State& state) { BM_ImportCsv(state, true); }
+
+BENCHMARK(BM_ImportCsvSingleThreaded)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_ImportCsvParallel)->Range(1 << 16, 1 << 20);
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../benchmark_utils.hpp"
+#include "operators/join_hash.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Joins a table of state.range(0) rows with a table ten times its size on a column of type T.
+// The second argument selects the number of radix bits, -1 lets the join choose it.
+template <typename T>
+void BM_JoinHash(benchmark::State& state) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  const auto build_size = static_cast<size_t>(state.range(0));
+  const auto probe_size = build_size * 10;
+
+  auto create_table = [&](const size_t row_count) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", data_type_name<T>());
+    for (size_t i = 0; i < row_count; ++i) table->append({generate_value<T>(i, build_size)});
+    return table;
+  };
+  const auto build_table = create_table(build_size);
+  const auto probe_table = create_table(probe_size);
+
+  const auto radix_bits = state.range(1) < 0 ? std::nullopt : std::optional<uint8_t>(state.range(1));
+  const auto join = JoinHash{build_table, probe_table, ColumnID{0}, ColumnID{0}, radix_bits};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(join.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * (build_size + probe_size));
+}
+
+BENCHMARK_TEMPLATE(BM_JoinHash, int32_t)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {-1, 0, 4, 8}});
+BENCHMARK_TEMPLATE(BM_JoinHash, std::string)->ArgsProduct({{1 << 12, 1 << 16}, {-1, 0}});
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Scans a single column table of type T for values less than the median, optionally on dictionary-compressed chunks
+template <typename T>
+void BM_TableScan(benchmark::State& state, const bool compress) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  constexpr size_t distinct_values = 1000;
+  const auto row_count = static_cast<size_t>(state.range(0));
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", data_type_name<T>());
+  for (size_t i = 0; i < row_count; ++i) table->append({generate_value<T>(i, distinct_values)});
+  if (compress) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  }
+
+  const auto scan = TableScan{table, ColumnID{0}, ScanType::OpLessThan, generate_value<T>(0, distinct_values / 2)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scan.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+void BM_TableScanValueInt(benchmark::State& state) { BM_TableScan<int32_t>(state, false); }
+void BM_TableScanValueDouble(benchmark::State& state) { BM_TableScan<double>(state, false); }
+void BM_TableScanValueString(benchmark::State& state) { BM_TableScan<std::string>(state, false); }
+void BM_TableScanDictionaryInt(benchmark::State& state) { BM_TableScan<int32_t>(state, true); }
+void BM_TableScanDictionaryString(benchmark::State& state) { BM_TableScan<std::string>(state, true); }
+
+// Scans for a single string among strings that differ in their first characters and are too long to be stored inline
+// by std::string, e.g., names or URLs
+void BM_TableScanValueLongString(benchmark::State& state) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto make_string = [](const size_t i) { return std::to_string(i * 7919 % 1000) + " is not stored inline"; };
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "string");
+  for (size_t i = 0; i < row_count; ++i) table->append({make_string(i)});
+
+  const auto scan = TableScan{table, ColumnID{0}, ScanType::OpEquals, make_string(42)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scan.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+// Scans a dictionary-compressed int column for a single value, optionally using an index on every chunk
+void BM_TableScanPointLookup(benchmark::State& state, const std::optional<ColumnIndexType> index_type) {
+  constexpr uint32_t chunk_size = 1 << 16;
+  constexpr size_t distinct_values = 100'000;
+  const auto row_count = static_cast<size_t>(state.range(0));
+
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  for (size_t i = 0; i < row_count; ++i) table->append({generate_value<int32_t>(i, distinct_values)});
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+    auto& chunk = table->get_chunk(chunk_id);
+    if (index_type == ColumnIndexType::GroupKey) chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+    if (index_type == ColumnIndexType::AdaptiveRadixTree) chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  }
+
+  const auto scan = TableScan{table, ColumnID{0}, ScanType::OpEquals, generate_value<int32_t>(42, distinct_values)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(scan.execute());
+  }
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+void BM_TableScanPointLookupNoIndex(benchmark::State& state) { BM_TableScanPointLookup(state, std::nullopt); }
+void BM_TableScanPointLookupGroupKey(benchmark::State& state) {
+  BM_TableScanPointLookup(state, ColumnIndexType::GroupKey);
+}
+void BM_TableScanPointLookupART(benchmark::State& state) {
+  BM_TableScanPointLookup(state, ColumnIndexType::AdaptiveRadixTree);
+}
+
+BENCHMARK(BM_TableScanValueInt)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanValueDouble)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanValueString)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanValueLongString)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanDictionaryInt)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanDictionaryString)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanPointLookupNoIndex)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanPointLookupGroupKey)->Range(1 << 16, 1 << 20);
+BENCHMARK(BM_TableScanPointLookupART)->Range(1 << 16, 1 << 20);
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+// Appends rows of two columns of type T to a chunk
+template <typename T>
+void BM_ChunkAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<size_t>(state.range(0));
+  std::vector<std::vector<AllTypeVariant>> rows;
+  for (size_t i = 0; i < chunk_size; ++i) rows.push_back({generate_value<T>(i), generate_value<T>(i + 1)});
+
+  for (auto _ : state) {
+    Chunk chunk;
+    chunk.add_column(std::make_shared<ValueColumn<T>>(chunk_size));
+    chunk.add_column(std::make_shared<ValueColumn<T>>(chunk_size));
+    for (const auto& row : rows) {
+      chunk.append(row);
+    }
+    benchmark::DoNotOptimize(chunk.size());
+  }
+  state.SetItemsProcessed(state.iterations() * chunk_size);
+}
+
+BENCHMARK_TEMPLATE(BM_ChunkAppend, int32_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ChunkAppend, int64_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ChunkAppend, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ChunkAppend, double)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ChunkAppend, std::string)->Range(1 << 10, 1 << 16);
+
+}  // namespace opossum
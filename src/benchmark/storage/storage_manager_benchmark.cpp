@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Looks up tables in a catalog with the given number of tables
+void BM_StorageManagerGetTable(benchmark::State& state) {
+  const auto table_count = state.range(0);
+  auto& storage_manager = StorageManager::get();
+  // in multi-threaded runs, only the first thread sets up the catalog. All threads start the loop together.
+  if (state.thread_index() == 0) {
+    for (auto i = 0; i < table_count; ++i) {
+      storage_manager.add_table("table_" + std::to_string(i), std::make_shared<Table>());
+    }
+  }
+  const auto name = "table_" + std::to_string(table_count / 2);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(storage_manager.get_table(name));
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) StorageManager::reset();
+}
+
+BENCHMARK(BM_StorageManagerGetTable)->Range(1, 1 << 12);
+BENCHMARK(BM_StorageManagerGetTable)->Range(1, 1 << 12)->Threads(4);
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+constexpr auto TABLE_BENCHMARK_ROWS = size_t{1} << 16;
+
+// Inserts TABLE_BENCHMARK_ROWS rows with two columns of type T row by row.
+// The argument is the table's chunk size.
+template <typename T>
+void BM_TableAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  std::vector<std::vector<AllTypeVariant>> rows;
+  for (size_t i = 0; i < TABLE_BENCHMARK_ROWS; ++i) rows.push_back({generate_value<T>(i), generate_value<T>(i + 1)});
+
+  for (auto _ : state) {
+    Table table{chunk_size};
+    table.add_column("a", data_type_name<T>());
+    table.add_column("b", data_type_name<T>());
+    for (const auto& row : rows) {
+      table.append(row);
+    }
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * TABLE_BENCHMARK_ROWS);
+}
+
+BENCHMARK_TEMPLATE(BM_TableAppend, int32_t)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+BENCHMARK_TEMPLATE(BM_TableAppend, int64_t)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+BENCHMARK_TEMPLATE(BM_TableAppend, float)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+BENCHMARK_TEMPLATE(BM_TableAppend, double)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+BENCHMARK_TEMPLATE(BM_TableAppend, std::string)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+
+// Inserts the same rows as BM_TableAppend in a single call to Table::append_columns
+template <typename T>
+void BM_TableAppendColumns(benchmark::State& state) {
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    Table table{chunk_size};
+    table.add_column("a", data_type_name<T>());
+    table.add_column("b", data_type_name<T>());
+    auto column_a = std::make_shared<ValueColumn<T>>(TABLE_BENCHMARK_ROWS);
+    auto column_b = std::make_shared<ValueColumn<T>>(TABLE_BENCHMARK_ROWS);
+    for (size_t i = 0; i < TABLE_BENCHMARK_ROWS; ++i) {
+      column_a->values().push_back(generate_value<T>(i));
+      column_b->values().push_back(generate_value<T>(i + 1));
+    }
+    state.ResumeTiming();
+
+    table.append_columns({column_a, column_b});
+    benchmark::DoNotOptimize(table.row_count());
+  }
+  state.SetItemsProcessed(state.iterations() * TABLE_BENCHMARK_ROWS);
+}
+
+BENCHMARK_TEMPLATE(BM_TableAppendColumns, int32_t)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+BENCHMARK_TEMPLATE(BM_TableAppendColumns, std::string)->Arg(1 << 10)->Arg(1 << 14)->Arg(0);
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.hpp"
+#include "all_type_variant.hpp"
+#include "storage/value_column.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+// Fills a column up to a full chunk. Without reserved capacity, the column's vector is
+// reallocated (and all previous values are moved) log2(chunk_size) times on the way.
+template <typename T>
+void BM_ValueColumnFillChunk(benchmark::State& state, const bool reserve, const T value) {
+  const auto chunk_size = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto column = reserve ? ValueColumn<T>{chunk_size} : ValueColumn<T>{};
+    auto& values = column.values();
+    for (size_t i = 0; i < chunk_size; ++i) {
+      values.push_back(value);
+    }
+    benchmark::DoNotOptimize(values);
+  }
+  state.SetItemsProcessed(state.iterations() * chunk_size);
+}
+
+BENCHMARK_CAPTURE(BM_ValueColumnFillChunk, int_unreserved, false, int32_t{17})->Range(1 << 10, 1 << 20);
+BENCHMARK_CAPTURE(BM_ValueColumnFillChunk, int_reserved, true, int32_t{17})->Range(1 << 10, 1 << 20);
+BENCHMARK_CAPTURE(BM_ValueColumnFillChunk, string_unreserved, false, std::string{"seventeen"})->Range(1 << 10, 1 << 20);
+BENCHMARK_CAPTURE(BM_ValueColumnFillChunk, string_reserved, true, std::string{"seventeen"})->Range(1 << 10, 1 << 20);
+
+// Appends values through the AllTypeVariant interface, as Chunk::append does
+template <typename T>
+void BM_ValueColumnAppend(benchmark::State& state) {
+  const auto chunk_size = static_cast<size_t>(state.range(0));
+  std::vector<AllTypeVariant> values;
+  for (size_t i = 0; i < chunk_size; ++i) values.emplace_back(generate_value<T>(i));
+
+  for (auto _ : state) {
+    ValueColumn<T> column{chunk_size};
+    for (const auto& value : values) {
+      column.append(value);
+    }
+    benchmark::DoNotOptimize(column.values());
+  }
+  state.SetItemsProcessed(state.iterations() * chunk_size);
+}
+
+BENCHMARK_TEMPLATE(BM_ValueColumnAppend, int32_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnAppend, int64_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnAppend, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnAppend, double)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnAppend, std::string)->Range(1 << 10, 1 << 16);
+
+// Reads all values through the virtual operator[], which returns an AllTypeVariant
+template <typename T>
+void BM_ValueColumnSubscript(benchmark::State& state) {
+  PerformanceWarningDisabler performance_warning_disabler;
+
+  const auto chunk_size = static_cast<size_t>(state.range(0));
+  ValueColumn<T> value_column{chunk_size};
+  for (size_t i = 0; i < chunk_size; ++i) value_column.values().push_back(generate_value<T>(i));
+  const BaseColumn& column = value_column;
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < chunk_size; ++i) {
+      benchmark::DoNotOptimize(column[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * chunk_size);
+}
+
+BENCHMARK_TEMPLATE(BM_ValueColumnSubscript, int32_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnSubscript, int64_t)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnSubscript, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnSubscript, double)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ValueColumnSubscript, std::string)->Range(1 << 10, 1 << 16);
+
+}  // namespace opossum
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 
+#include "null_value.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -60,8 +61,11 @@ static constexpr auto column_types = hana::transform(column_types_as_tuples, to_
 // Converts tuple to mpl vector
 using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
 
+// NullValue is the first type of the variant, so that a default-constructed AllTypeVariant is NULL
+using TypesAsMplVectorIncludingNull = typename boost::mpl::push_front<TypesAsMplVector, NullValue>::type;
+
 // Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVectorIncludingNull>::type;
 
 }  // namespace detail
 
@@ -70,6 +74,12 @@ static constexpr auto column_types = detail::column_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// the NULL value, i.e., a default-constructed AllTypeVariant
+static const auto NULL_VALUE = AllTypeVariant{};
+
+// returns whether the variant holds NULL. Use this instead of comparing with NULL_VALUE, which is never equal
+inline bool variant_is_null(const AllTypeVariant& variant) { return variant.which() == 0; }
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace detail {
+
+// Returns the number held by an AllTypeVariant, or given as a string, as a long double. It has at least 64 bits of
+// mantissa on the platforms we build on, so that every value of the numerical column types is represented exactly.
+struct ExactNumberVisitor : boost::static_visitor<long double> {
+  long double operator()(const NullValue&) const {
+    Fail("NULL cannot be cast to a value");
+    return 0.0L;
+  }
+
+  long double operator()(const std::string& value) const {
+    // integers are parsed as such, because doubles cannot represent all of them
+    auto integer = int64_t{};
+    if (parse_number(value, integer)) return static_cast<long double>(integer);
+    auto decimal = double{};
+    if (parse_number(value, decimal)) return static_cast<long double>(decimal);
+
+    Fail("'" + value + "' cannot be converted to the requested type");
+    return 0.0L;
+  }
+
+  template <typename Source>
+  long double operator()(const Source& value) const {
+    return static_cast<long double>(value);
+  }
+};
+
+}  // namespace detail
+
+// The predicate "column <scan_type> value" for a column of type T
+template <typename T>
+struct CastPredicate {
+  ScanType scan_type;
+  T value;
+};
+
+// Casts the value of the predicate "column <scan_type> value" to the column type T, adjusting the predicate so that it
+// matches exactly the values that the original one matches. Unlike type_cast, the value is not truncated: for an int
+// column, "< 2.5" becomes "<= 2", and "= 2.5" does not match anything. Values that T cannot represent (e.g., 5e9 for an
+// int column) either match all values or none. Predicates that match all values are expressed as ">= lowest value",
+// so that NULLs are still left out.
+// Returns std::nullopt if no value of type T satisfies the predicate, which includes all comparisons with NULL.
+// Throws if the value cannot be compared with T at all, e.g., if it is a string that is not a number.
+template <typename T>
+std::optional<CastPredicate<T>> cast_predicate(const ScanType scan_type, const AllTypeVariant& value) {
+  if (variant_is_null(value)) return std::nullopt;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return CastPredicate<T>{scan_type, type_cast<T>(value)};
+  } else {
+    if (value.which() == detail::variant_index_of<T>()) return CastPredicate<T>{scan_type, get<T>(value)};
+
+    constexpr auto lowest = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                                   : std::numeric_limits<T>::lowest();
+    constexpr auto max = std::numeric_limits<T>::max();
+    const auto matches_all = std::optional<CastPredicate<T>>{CastPredicate<T>{ScanType::OpGreaterThanEquals, lowest}};
+
+    const auto number = boost::apply_visitor(detail::ExactNumberVisitor{}, value);
+
+    // NaN is neither equal to, less than, nor greater than any value
+    if (std::isnan(number)) {
+      if (scan_type == ScanType::OpNotEquals) return matches_all;
+      return std::nullopt;
+    }
+
+    if constexpr (std::is_integral_v<T>) {
+      // the number is less or greater than all values of T
+      const auto below_all = number < static_cast<long double>(lowest);
+      const auto above_all = number > static_cast<long double>(max);
+      if (below_all || above_all) {
+        switch (scan_type) {
+          case ScanType::OpEquals:
+            return std::nullopt;
+          case ScanType::OpNotEquals:
+            return matches_all;
+          case ScanType::OpLessThan:
+          case ScanType::OpLessThanEquals:
+            return above_all ? matches_all : std::nullopt;
+          case ScanType::OpGreaterThan:
+          case ScanType::OpGreaterThanEquals:
+            return below_all ? matches_all : std::nullopt;
+        }
+        Fail("Unknown scan type");
+      }
+    }
+
+    // finite numbers beyond the range of a floating point type lie between its largest finite value and infinity
+    auto lower_value = T{};
+    if (std::is_floating_point_v<T> && number > static_cast<long double>(max)) {
+      lower_value = max;
+    } else if (std::is_floating_point_v<T> && number < static_cast<long double>(std::numeric_limits<T>::lowest())) {
+      lower_value = lowest;
+    } else {
+      lower_value = static_cast<T>(number);
+      if (static_cast<long double>(lower_value) == number) return CastPredicate<T>{scan_type, lower_value};
+
+      // integers are truncated towards zero and floating point numbers rounded to the nearest value, so the cast value
+      // can be greater than the number
+      if (static_cast<long double>(lower_value) > number) {
+        if constexpr (std::is_integral_v<T>) {
+          --lower_value;
+        } else {
+          lower_value = std::nextafter(lower_value, lowest);
+        }
+      }
+    }
+
+    // the number lies between lower_value and the next greater value of T, so no value of T is equal to it
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return std::nullopt;
+      case ScanType::OpNotEquals:
+        return matches_all;
+      case ScanType::OpLessThan:
+      case ScanType::OpLessThanEquals:
+        return CastPredicate<T>{ScanType::OpLessThanEquals, lower_value};
+      case ScanType::OpGreaterThan:
+      case ScanType::OpGreaterThanEquals:
+        return CastPredicate<T>{ScanType::OpGreaterThan, lower_value};
+    }
+  }
+  Fail("Unknown scan type");
+  return std::nullopt;
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ostream>
+
+namespace opossum {
+
+/**
+ * Represents SQL's NULL in an AllTypeVariant. Following SQL, a comparison with NULL is never true, i.e., NULL is
+ * neither equal to, nor less or greater than any value, not even NULL itself.
+ */
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return false; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+inline bool operator<=(const NullValue&, const NullValue&) { return false; }
+inline bool operator>(const NullValue&, const NullValue&) { return false; }
+inline bool operator>=(const NullValue&, const NullValue&) { return false; }
+
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
+}  // namespace opossum
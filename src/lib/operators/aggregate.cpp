@@ -0,0 +1,548 @@
+#include "aggregate.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Assigns dense ids to values: equal values get the same id, new values the next free one. All NULLs share an id,
+// which is not used by any value. Strings are looked up as std::string_views, which have to stay valid as long as the
+// map is used, e.g., because they refer to a column. Only the strings of new ids are copied.
+template <typename T>
+class DenseIdMap {
+ public:
+  using Key = typename ColumnIteratorValue<T>::ValueType;
+
+  uint32_t get_or_add(const Key& value) {
+    const auto inserted = _ids.emplace(value, static_cast<uint32_t>(_values.size()));
+    if (inserted.second) _values.emplace_back(value);
+    return inserted.first->second;
+  }
+
+  uint32_t get_or_add_null() {
+    if (!_null_id) {
+      _null_id = static_cast<uint32_t>(_values.size());
+      _values.emplace_back();
+    }
+    return *_null_id;
+  }
+
+  // returns the values in the order of their ids. The value of the NULL id is default-constructed
+  std::vector<T>& values() { return _values; }
+
+  // returns the id of NULL, if there was a NULL
+  std::optional<uint32_t> null_id() const { return _null_id; }
+
+ private:
+  std::unordered_map<Key, uint32_t> _ids;
+  std::vector<T> _values;
+  std::optional<uint32_t> _null_id;
+};
+
+// The dense ids of the rows of a group-by column
+template <typename T>
+struct DenseValueIds {
+  // the id of every row
+  std::vector<uint32_t> value_ids;
+
+  // the values in the order of their ids
+  std::vector<T> values;
+
+  // the id of NULL, if there was a NULL
+  std::optional<uint32_t> null_id;
+};
+
+// Combines the group id of a row (from the previous group-by columns) with the value id of a further group-by column
+// into a new dense group id. As both ids are smaller than 2^32, they are packed into a single integer key, so that no
+// composite keys have to be hashed.
+uint32_t combine_ids(std::unordered_map<uint64_t, uint32_t>& combined_ids, const uint32_t group_id,
+                     const uint32_t value_id) {
+  const auto key = (static_cast<uint64_t>(group_id) << 32) | value_id;
+  return combined_ids.emplace(key, static_cast<uint32_t>(combined_ids.size())).first->second;
+}
+
+// calls func(chunk_offset, value) for the first chunk_size values of a column that are not NULL, without virtual calls
+// per value. Value columns skip their NULLs word by word of the null bitmap.
+template <typename T, typename Functor>
+void for_each_value(const BaseColumn& column, const ChunkOffset chunk_size, const Functor& func) {
+  resolve_column_type<T>(column, [&](const auto& typed_column) {
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    if constexpr (std::is_same<ColumnType, ValueColumn<T>>::value) {
+      // strings are passed on as std::string_views into the column, so that they are not copied
+      const auto& values = typed_column.values();
+      const auto null_values = typed_column.is_nullable() ? &typed_column.null_values() : nullptr;
+      for_each_non_null(null_values, chunk_size,
+                        [&](const size_t index) { func(static_cast<ChunkOffset>(index), values[index]); });
+    } else {
+      create_iterable_from_column<T>(typed_column, chunk_size).with_iterators([&](auto it, auto end) {
+        for (; it != end; ++it) {
+          if (it->is_null()) continue;
+          func(it->chunk_offset(), it->value());
+        }
+      });
+    }
+  });
+}
+
+// Assigns dense ids to the first chunk_size values of a column
+template <typename T>
+DenseValueIds<T> assign_value_ids(const BaseColumn& column, const ChunkOffset chunk_size) {
+  DenseValueIds<T> dense_value_ids;
+  auto& value_ids = dense_value_ids.value_ids;
+  value_ids.resize(chunk_size);
+
+  resolve_column_type<T>(column, [&](const auto& typed_column) {
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    if constexpr (std::is_same<ColumnType, DictionaryColumn<T>>::value) {
+      // the dictionary holds exactly the distinct values of the column, so its ValueIDs are dense ids already. The
+      // null value id follows the last dictionary entry, so it is dense as well.
+      const auto null_value_id = static_cast<ValueID::base_type>(typed_column.null_value_id());
+      auto has_null = false;
+      resolve_attribute_vector_type(*typed_column.attribute_vector(), [&](const auto& attribute_vector) {
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          value_ids[chunk_offset] = static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset));
+          has_null |= value_ids[chunk_offset] == null_value_id;
+        }
+      });
+      const auto& dictionary = *typed_column.dictionary();
+      dense_value_ids.values.assign(dictionary.cbegin(), dictionary.cend());
+      if (typed_column.is_nullable() && has_null) {
+        dense_value_ids.values.emplace_back();
+        dense_value_ids.null_id = null_value_id;
+      }
+    } else {
+      DenseIdMap<T> id_map;
+      create_iterable_from_column<T>(typed_column, chunk_size).with_iterators([&](auto it, auto end) {
+        for (; it != end; ++it) {
+          value_ids[it->chunk_offset()] = it->is_null() ? id_map.get_or_add_null() : id_map.get_or_add(it->value());
+        }
+      });
+      dense_value_ids.values = std::move(id_map.values());
+      dense_value_ids.null_id = id_map.null_id();
+    }
+  });
+
+  return dense_value_ids;
+}
+
+// Copies values into the container of a value column
+template <typename T>
+ValueVector<T> to_value_vector(const std::vector<T>& values) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return StringVector{values};
+  } else {
+    return ValueVector<T>(values.cbegin(), values.cend());
+  }
+}
+
+// Creates a value column of the given values. If the values are nullable, the values of the groups for which
+// is_null(group) returns true are NULL.
+template <typename T, typename IsNull>
+std::shared_ptr<BaseColumn> make_result_column(ValueVector<T>&& values, const bool nullable, const IsNull& is_null) {
+  if (!nullable) return std::make_shared<ValueColumn<T>>(std::move(values));
+
+  NullBitmap null_values(values.size());
+  for (size_t group = 0; group < values.size(); ++group) {
+    if (is_null(group)) null_values.set_null(group, true);
+  }
+  return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
+}
+
+// The states of one aggregate for all groups
+class BaseAggregateStates {
+ public:
+  virtual ~BaseAggregateStates() = default;
+
+  // aggregates the values of the column, row_groups holds the group of each row that is to be aggregated
+  virtual void aggregate(const BaseColumn& column, const std::vector<uint32_t>& row_groups) = 0;
+
+  // merges the states of other into this one, group_mapping maps the groups of other to the groups of this one
+  virtual void merge(const BaseAggregateStates& other, const std::vector<uint32_t>& group_mapping) = 0;
+
+  // returns the aggregated value of every group
+  virtual std::shared_ptr<BaseColumn> result_column() const = 0;
+};
+
+template <typename T>
+class AggregateStates : public BaseAggregateStates {
+ public:
+  // integral values are summed up exactly, floating point values as double
+  using SumType = std::conditional_t<std::is_integral<T>::value, int64_t, double>;
+
+  // nullable states count the non-NULL values only, and the aggregate of a group without such values is NULL
+  AggregateStates(const AggregateFunction function, const size_t group_count, const bool nullable)
+      : _function{function}, _nullable{nullable}, _counts(group_count) {
+    if (function == AggregateFunction::Sum || function == AggregateFunction::Avg) _sums.resize(group_count);
+    if (function == AggregateFunction::Min || function == AggregateFunction::Max) _extrema.resize(group_count);
+  }
+
+  void aggregate(const BaseColumn& column, const std::vector<uint32_t>& row_groups) override {
+    const auto chunk_size = static_cast<ChunkOffset>(row_groups.size());
+
+    switch (_function) {
+      case AggregateFunction::Min:
+        return for_each_value<T>(column, chunk_size, [&](const ChunkOffset chunk_offset, const auto& value) {
+          _update_extremum(row_groups[chunk_offset], value, std::less<>{});
+        });
+      case AggregateFunction::Max:
+        return for_each_value<T>(column, chunk_size, [&](const ChunkOffset chunk_offset, const auto& value) {
+          _update_extremum(row_groups[chunk_offset], value, std::greater<>{});
+        });
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic<T>::value) {
+          return for_each_value<T>(column, chunk_size, [&](const ChunkOffset chunk_offset, const auto& value) {
+            const auto group = row_groups[chunk_offset];
+            _sums[group] += value;
+            ++_counts[group];
+          });
+        } else {
+          return Fail("SUM and AVG require numerical columns");
+        }
+      case AggregateFunction::Count:
+        if (_nullable) {
+          return for_each_value<T>(column, chunk_size, [&](const ChunkOffset chunk_offset, const auto&) {
+            ++_counts[row_groups[chunk_offset]];
+          });
+        }
+        // COUNT does not depend on the values
+        for (const auto group : row_groups) {
+          ++_counts[group];
+        }
+        return;
+    }
+    Fail("Unknown aggregate function");
+  }
+
+  void merge(const BaseAggregateStates& base_other, const std::vector<uint32_t>& group_mapping) override {
+    const auto& other = static_cast<const AggregateStates<T>&>(base_other);
+
+    for (size_t other_group = 0; other_group < group_mapping.size(); ++other_group) {
+      // a group without (non-NULL) values contributes nothing. In particular, its extremum is not set and must not
+      // replace a valid one
+      if (other._counts[other_group] == 0) continue;
+      const auto group = group_mapping[other_group];
+
+      if (_function == AggregateFunction::Min) {
+        _update_extremum(group, other._extrema[other_group], std::less<>{}, other._counts[other_group]);
+      } else if (_function == AggregateFunction::Max) {
+        _update_extremum(group, other._extrema[other_group], std::greater<>{}, other._counts[other_group]);
+      } else {
+        if (!_sums.empty()) _sums[group] += other._sums[other_group];
+        _counts[group] += other._counts[other_group];
+      }
+    }
+  }
+
+  std::shared_ptr<BaseColumn> result_column() const override {
+    const auto is_empty = [&](const size_t group) { return _counts[group] == 0; };
+
+    switch (_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return make_result_column<T>(to_value_vector(_extrema), _nullable, is_empty);
+      case AggregateFunction::Sum:
+        return make_result_column<SumType>(to_value_vector(_sums), _nullable, is_empty);
+      case AggregateFunction::Avg: {
+        ValueVector<double> averages(_counts.size());
+        for (size_t group = 0; group < _counts.size(); ++group) {
+          if (is_empty(group)) continue;
+          averages[group] = static_cast<double>(_sums[group]) / static_cast<double>(_counts[group]);
+        }
+        return make_result_column<double>(std::move(averages), _nullable, is_empty);
+      }
+      case AggregateFunction::Count:
+        return std::make_shared<ValueColumn<int64_t>>(ValueVector<int64_t>(_counts.cbegin(), _counts.cend()));
+    }
+    Fail("Unknown aggregate function");
+    return nullptr;
+  }
+
+ private:
+  // a group's first value is its extremum, afterwards the extremum is only replaced by more extreme values
+  template <typename Value, typename Comparator>
+  void _update_extremum(const uint32_t group, const Value& value, const Comparator& comparator,
+                        const uint64_t count = 1) {
+    if (_counts[group] == 0 || comparator(value, _extrema[group])) _extrema[group] = value;
+    _counts[group] += count;
+  }
+
+  const AggregateFunction _function;
+  const bool _nullable;
+  std::vector<uint64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _extrema;
+};
+
+}  // namespace
+
+struct Aggregate::PartialAggregate {
+  size_t group_count;
+
+  // the values of the groups, i.e., one ValueColumn per group-by column with one value per group
+  std::vector<std::shared_ptr<BaseColumn>> group_values;
+
+  // the states of every aggregate for every group
+  std::vector<std::shared_ptr<BaseAggregateStates>> aggregate_states;
+};
+
+Aggregate::Aggregate(const std::shared_ptr<const Table> table, const std::vector<AggregateDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : _table{table}, _aggregates{aggregates}, _group_by_column_ids{group_by_column_ids} {
+  for (const auto& aggregate : aggregates) {
+    Assert(aggregate.column_id < table->col_count(), "Aggregate column does not exist");
+    Assert(table->column_type(aggregate.column_id) != "string" ||
+               (aggregate.function != AggregateFunction::Sum && aggregate.function != AggregateFunction::Avg),
+           "SUM and AVG require numerical columns");
+  }
+  for (const auto& column_id : group_by_column_ids) {
+    Assert(column_id < table->col_count(), "Group-by column does not exist");
+  }
+}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::execute() const {
+  // every chunk is aggregated by a job of its own
+  const auto chunk_count = _table->chunk_count();
+  std::vector<std::optional<PartialAggregate>> chunk_partial_aggregates(chunk_count);
+
+  std::vector<std::shared_ptr<JobTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = _table->get_chunk(chunk_id);
+    // rows that are appended concurrently are not visible yet and must not be aggregated
+    const auto chunk_size = chunk.size();
+    if (chunk_size == 0) continue;
+
+    jobs.push_back(std::make_shared<JobTask>([&, chunk_id, chunk_size]() {
+      chunk_partial_aggregates[chunk_id] = _aggregate_chunk(chunk, chunk_size);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  std::vector<PartialAggregate> partial_aggregates;
+  partial_aggregates.reserve(jobs.size());
+  for (auto& partial_aggregate : chunk_partial_aggregates) {
+    if (partial_aggregate) partial_aggregates.push_back(std::move(*partial_aggregate));
+  }
+
+  return _merge(partial_aggregates);
+}
+
+Aggregate::PartialAggregate Aggregate::_aggregate_chunk(const Chunk& chunk, const ChunkOffset chunk_size) const {
+  PartialAggregate partial_aggregate;
+
+  // without group-by columns, all rows belong to group 0
+  std::vector<uint32_t> row_groups(chunk_size);
+  size_t group_count = 1;
+
+  // creates the values of the groups once the first row of every group is known
+  std::vector<std::function<std::shared_ptr<BaseColumn>(const std::vector<ChunkOffset>&)>> create_group_values;
+
+  for (const auto& column_id : _group_by_column_ids) {
+    resolve_data_type(_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto [value_ids, values, null_id] = assign_value_ids<ColumnDataType>(*chunk.get_column(column_id), chunk_size);
+
+      if (create_group_values.empty()) {
+        row_groups = value_ids;
+        group_count = values.size();
+      } else {
+        std::unordered_map<uint64_t, uint32_t> combined_ids;
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          row_groups[chunk_offset] = combine_ids(combined_ids, row_groups[chunk_offset], value_ids[chunk_offset]);
+        }
+        group_count = combined_ids.size();
+      }
+
+      create_group_values.push_back([value_ids = std::move(value_ids), values = std::move(values),
+                                     null_id = null_id](const std::vector<ChunkOffset>& group_rows) {
+        ValueVector<ColumnDataType> group_values;
+        group_values.reserve(group_rows.size());
+        for (const auto chunk_offset : group_rows) {
+          group_values.push_back(values[value_ids[chunk_offset]]);
+        }
+        return make_result_column<ColumnDataType>(std::move(group_values), null_id.has_value(),
+                                  [&](const size_t group) { return value_ids[group_rows[group]] == *null_id; });
+      });
+    });
+  }
+
+  constexpr auto no_row = std::numeric_limits<ChunkOffset>::max();
+  std::vector<ChunkOffset> group_rows(group_count, no_row);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+    auto& group_row = group_rows[row_groups[chunk_offset]];
+    if (group_row == no_row) group_row = chunk_offset;
+  }
+
+  partial_aggregate.group_count = group_count;
+  for (const auto& create : create_group_values) {
+    partial_aggregate.group_values.push_back(create(group_rows));
+  }
+
+  for (const auto& aggregate : _aggregates) {
+    auto states = make_shared_by_column_type<BaseAggregateStates, AggregateStates>(
+        _table->column_type(aggregate.column_id), aggregate.function, group_count,
+        _table->column_is_nullable(aggregate.column_id));
+    states->aggregate(*chunk.get_column(aggregate.column_id), row_groups);
+    partial_aggregate.aggregate_states.push_back(states);
+  }
+
+  return partial_aggregate;
+}
+
+std::shared_ptr<const Table> Aggregate::_merge(const std::vector<PartialAggregate>& partial_aggregates) const {
+  // maps the groups of each partial aggregate to the groups of the result
+  std::vector<std::vector<uint32_t>> group_mappings;
+  for (const auto& partial_aggregate : partial_aggregates) {
+    group_mappings.emplace_back(partial_aggregate.group_count);
+  }
+  // without group-by columns, there is exactly one group, even if the input table is empty
+  size_t group_count = _group_by_column_ids.empty() ? 1 : 0;
+
+  // the groups are merged by their values, in the same way as rows are grouped within a chunk
+  for (ColumnID group_by_index{0}; group_by_index < _group_by_column_ids.size(); ++group_by_index) {
+    resolve_data_type(_table->column_type(_group_by_column_ids[group_by_index]), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      DenseIdMap<ColumnDataType> id_map;
+      std::unordered_map<uint64_t, uint32_t> combined_ids;
+
+      for (size_t partial_index = 0; partial_index < partial_aggregates.size(); ++partial_index) {
+        const auto& group_values = static_cast<const ValueColumn<ColumnDataType>&>(
+            *partial_aggregates[partial_index].group_values[group_by_index]);
+        const auto& values = group_values.values();
+        auto& group_mapping = group_mappings[partial_index];
+
+        for (size_t group = 0; group < values.size(); ++group) {
+          const auto value_id =
+              group_values.is_null(group) ? id_map.get_or_add_null() : id_map.get_or_add(values[group]);
+          group_mapping[group] =
+              group_by_index == 0 ? value_id : combine_ids(combined_ids, group_mapping[group], value_id);
+        }
+      }
+
+      group_count = group_by_index == 0 ? id_map.values().size() : combined_ids.size();
+    });
+  }
+
+  auto result = std::make_shared<Table>();
+  auto& result_chunk = result->get_chunk(ChunkID{0});
+
+  // the values of a group are taken from the first partial aggregate that contains it
+  std::vector<std::pair<size_t, uint32_t>> group_origins(group_count, {partial_aggregates.size(), 0});
+  for (size_t partial_index = 0; partial_index < partial_aggregates.size(); ++partial_index) {
+    const auto& group_mapping = group_mappings[partial_index];
+    for (uint32_t group = 0; group < group_mapping.size(); ++group) {
+      auto& origin = group_origins[group_mapping[group]];
+      if (origin.first == partial_aggregates.size()) origin = {partial_index, group};
+    }
+  }
+
+  for (ColumnID group_by_index{0}; group_by_index < _group_by_column_ids.size(); ++group_by_index) {
+    const auto column_id = _group_by_column_ids[group_by_index];
+    const auto nullable = _table->column_is_nullable(column_id);
+    result->add_column_definition(_table->column_name(column_id), _table->column_type(column_id), nullable);
+
+    resolve_data_type(_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto partial_values = [&](const size_t partial_index) -> const ValueColumn<ColumnDataType>& {
+        return static_cast<const ValueColumn<ColumnDataType>&>(
+            *partial_aggregates[partial_index].group_values[group_by_index]);
+      };
+
+      ValueVector<ColumnDataType> values;
+      values.reserve(group_count);
+      for (const auto& [partial_index, group] : group_origins) {
+        values.push_back(partial_values(partial_index).values()[group]);
+      }
+      result_chunk.add_column(make_result_column<ColumnDataType>(std::move(values), nullable, [&](const size_t group) {
+        const auto& [partial_index, partial_group] = group_origins[group];
+        return partial_values(partial_index).is_null(partial_group);
+      }));
+    });
+  }
+
+  for (size_t aggregate_index = 0; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    const auto& aggregate = _aggregates[aggregate_index];
+    // the single group of an aggregate without group-by columns is empty for an empty input table
+    const auto nullable = _table->column_is_nullable(aggregate.column_id) || _group_by_column_ids.empty();
+    // COUNT is never NULL, all other aggregates are NULL for groups without non-NULL values
+    result->add_column_definition(_aggregate_column_name(aggregate), _aggregate_column_type(aggregate),
+                                  nullable && aggregate.function != AggregateFunction::Count);
+
+    auto states = make_shared_by_column_type<BaseAggregateStates, AggregateStates>(
+        _table->column_type(aggregate.column_id), aggregate.function, group_count, nullable);
+    for (size_t partial_index = 0; partial_index < partial_aggregates.size(); ++partial_index) {
+      states->merge(*partial_aggregates[partial_index].aggregate_states[aggregate_index],
+                    group_mappings[partial_index]);
+    }
+    result_chunk.add_column(states->result_column());
+  }
+
+  return result;
+}
+
+std::string Aggregate::_aggregate_column_name(const AggregateDefinition& aggregate) const {
+  const auto& column_name = _table->column_name(aggregate.column_id);
+  switch (aggregate.function) {
+    case AggregateFunction::Min:
+      return "MIN(" + column_name + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+std::string Aggregate::_aggregate_column_type(const AggregateDefinition& aggregate) const {
+  const auto& column_type = _table->column_type(aggregate.column_id);
+  switch (aggregate.function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return column_type;
+    case AggregateFunction::Sum:
+      return column_type == "int" || column_type == "long" ? "long" : "double";
+    case AggregateFunction::Avg:
+      return "double";
+    case AggregateFunction::Count:
+      return "long";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// an aggregate function applied to a column, e.g., SUM(b)
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Aggregate groups the rows of a table by the values of zero or more columns and computes MIN, MAX, SUM, AVG, and
+// COUNT per group. The result is a new table with the group-by columns followed by one column per aggregate, named
+// like "SUM(b)". COUNT results are of type long, SUM results of type long (for integral inputs) or double, and AVG
+// results of type double. Without group-by columns, all rows form a single group.
+// As in SQL, NULLs are ignored by all aggregates, i.e., COUNT only counts values that are not NULL, and the other
+// aggregates of a group without such values are NULL. NULLs in group-by columns form a group of their own.
+//
+// Each chunk is aggregated independently into a partial result by a job of its own (see CurrentScheduler). The partial
+// results are merged afterwards. Group keys are built from typed values: every group-by column assigns dense ids to
+// its values (dictionary columns reuse their ValueIDs), which are then combined into a single integer key per row.
+// A single group-by column thus needs a single hash lookup per row, and AllTypeVariants are never hashed.
+class Aggregate : private Noncopyable {
+ public:
+  Aggregate(const std::shared_ptr<const Table> table, const std::vector<AggregateDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  // computes the aggregates and returns them as a new table
+  std::shared_ptr<const Table> execute() const;
+
+ protected:
+  struct PartialAggregate;
+
+  // aggregates the first chunk_size rows of a chunk
+  PartialAggregate _aggregate_chunk(const Chunk& chunk, const ChunkOffset chunk_size) const;
+
+  // merges the partial aggregates of all chunks into the result table
+  std::shared_ptr<const Table> _merge(const std::vector<PartialAggregate>& partial_aggregates) const;
+
+  // returns the name and the type of the output column of an aggregate
+  std::string _aggregate_column_name(const AggregateDefinition& aggregate) const;
+  std::string _aggregate_column_type(const AggregateDefinition& aggregate) const;
+
+  const std::shared_ptr<const Table> _table;
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
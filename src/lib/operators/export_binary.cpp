@@ -0,0 +1,202 @@
+#include "export_binary.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/null_bitmap.hpp"
+#include "storage/string_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ofstream& file, const std::string& string) {
+  write_value(file, static_cast<uint32_t>(string.size()));
+  file.write(string.data(), static_cast<std::streamsize>(string.size()));
+}
+
+// writes count elements starting at an aligned offset
+template <typename T>
+void write_array(std::ofstream& file, const T* values, const size_t count) {
+  static_assert(std::is_arithmetic<T>::value, "Only arrays of numbers can be written directly");
+  constexpr char padding[BINARY_FORMAT_ALIGNMENT] = {};
+  const auto offset = static_cast<size_t>(file.tellp());
+  file.write(padding, static_cast<std::streamsize>((BINARY_FORMAT_ALIGNMENT - offset % BINARY_FORMAT_ALIGNMENT) %
+                                                   BINARY_FORMAT_ALIGNMENT));
+  file.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+// writes the values of a value column or a dictionary (see "Values" in export_binary.hpp)
+template <typename T>
+void write_values(std::ofstream& file, const T* values, const size_t count) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    std::vector<uint32_t> lengths(count);
+    for (size_t index = 0; index < count; ++index) {
+      lengths[index] = static_cast<uint32_t>(values[index].size());
+    }
+    write_array(file, lengths.data(), count);
+    for (size_t index = 0; index < count; ++index) {
+      file.write(values[index].data(), static_cast<std::streamsize>(values[index].size()));
+    }
+  } else {
+    write_array(file, values, count);
+  }
+}
+
+// writes the first count strings of a string value column in the same format
+void write_values(std::ofstream& file, const StringVector& values, const size_t count) {
+  std::vector<uint32_t> lengths(count);
+  for (size_t index = 0; index < count; ++index) {
+    lengths[index] = static_cast<uint32_t>(values[index].size());
+  }
+  write_array(file, lengths.data(), count);
+  // the strings are stored back to back already
+  const auto chars = values.chars(count);
+  file.write(chars.data(), static_cast<std::streamsize>(chars.size()));
+}
+
+// writes the words of the first row_count positions of a null bitmap. Without a null bitmap, no value is NULL.
+void write_null_bitmap(std::ofstream& file, const NullBitmap* null_values, const size_t row_count) {
+  std::vector<uint64_t> words(NullBitmap::word_count(row_count));
+  if (null_values) {
+    std::copy_n(null_values->words().cbegin(), words.size(), words.begin());
+    // rows that are appended concurrently might have set the bits behind the exported rows
+    const auto used_bits = row_count % NullBitmap::BITS_PER_WORD;
+    if (used_bits != 0) words.back() &= (uint64_t{1} << used_bits) - 1;
+  }
+  write_array(file, words.data(), words.size());
+}
+
+}  // namespace
+
+ExportBinary::ExportBinary(const std::shared_ptr<const Table> table, const std::string& filename)
+    : _table{table}, _filename{filename} {}
+
+void ExportBinary::execute() const {
+  std::ofstream file(_filename, std::ios::binary | std::ios::trunc);
+  Assert(file.is_open(), "Cannot open file " + _filename);
+
+  const auto chunk_count = _table->chunk_count();
+  file.write(BINARY_FORMAT_MAGIC, sizeof(BINARY_FORMAT_MAGIC));
+  write_value(file, BINARY_FORMAT_VERSION);
+  write_value(file, _table->chunk_size());
+  write_value(file, static_cast<ChunkID::base_type>(chunk_count));
+  write_value(file, _table->col_count());
+  for (ColumnID column_id{0}; column_id < _table->col_count(); ++column_id) {
+    write_string(file, _table->column_type(column_id));
+  }
+  for (ColumnID column_id{0}; column_id < _table->col_count(); ++column_id) {
+    write_value(file, static_cast<uint8_t>(_table->column_is_nullable(column_id)));
+  }
+  for (ColumnID column_id{0}; column_id < _table->col_count(); ++column_id) {
+    write_string(file, _table->column_name(column_id));
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    _write_chunk(file, _table->get_chunk(chunk_id));
+  }
+
+  file.close();
+  Assert(!file.fail(), "Cannot write file " + _filename);
+}
+
+void ExportBinary::_write_chunk(std::ofstream& file, const Chunk& chunk) const {
+  // rows that are appended concurrently are not exported
+  const auto row_count = chunk.size();
+  write_value(file, static_cast<ChunkOffset>(row_count));
+
+  for (ColumnID column_id{0}; column_id < _table->col_count(); ++column_id) {
+    const auto column = chunk.get_column(column_id);
+    resolve_data_type(_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _write_column<ColumnDataType>(file, *column, row_count, _table->column_is_nullable(column_id));
+    });
+  }
+}
+
+template <typename T>
+void ExportBinary::_write_column(std::ofstream& file, const BaseColumn& column, const ChunkOffset row_count,
+                                 const bool nullable) const {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    write_value(file, BinaryColumnEncoding::Dictionary);
+    const auto& dictionary = *dictionary_column->dictionary();
+    write_value(file, static_cast<uint32_t>(dictionary.size()));
+    write_values(file, dictionary.data(), dictionary.size());
+    _write_attribute_vector(file, *dictionary_column->attribute_vector(), row_count);
+    return;
+  }
+
+  write_value(file, BinaryColumnEncoding::Value);
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      write_values(file, value_column->values(), row_count);
+    } else {
+      write_values(file, value_column->values().data(), row_count);
+    }
+    if (nullable) {
+      write_null_bitmap(file, value_column->is_nullable() ? &value_column->null_values() : nullptr, row_count);
+    }
+    return;
+  }
+
+  // the values of reference columns are materialized, strings into a single buffer
+  ValueVector<T> values;
+  values.reserve(row_count);
+  NullBitmap null_values;
+  resolve_column_type<T>(column, [&](const auto& typed_column) {
+    create_iterable_from_column<T>(typed_column).for_each([&](const auto& value) {
+      values.push_back(value.value());
+      null_values.push_back(value.is_null());
+    });
+  });
+  if constexpr (std::is_same<T, std::string>::value) {
+    write_values(file, values, values.size());
+  } else {
+    write_values(file, values.data(), values.size());
+  }
+  if (nullable) write_null_bitmap(file, &null_values, values.size());
+}
+
+void ExportBinary::_write_attribute_vector(std::ofstream& file, const BaseAttributeVector& attribute_vector,
+                                           const ChunkOffset row_count) {
+  DebugAssert(attribute_vector.size() == row_count, "Dictionary columns cannot grow");
+
+  resolve_attribute_vector_type(attribute_vector, [&](const auto& typed_attribute_vector) {
+    using AttributeVectorType = std::decay_t<decltype(typed_attribute_vector)>;
+
+    if constexpr (std::is_same<AttributeVectorType, BitPackedAttributeVector>::value) {
+      const auto& words = typed_attribute_vector.words();
+      write_value(file, AttributeVectorWidth{0});
+      write_value(file, typed_attribute_vector.bit_width());
+      write_value(file, static_cast<uint32_t>(words.size()));
+      write_array(file, words.data(), words.size());
+    } else if constexpr (std::is_same<AttributeVectorType, BaseAttributeVector>::value) {
+      Fail("Unknown attribute vector type");
+    } else {
+      const auto& value_ids = typed_attribute_vector.values();
+      write_value(file, typed_attribute_vector.width());
+      write_array(file, value_ids.data(), value_ids.size());
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+class BaseColumn;
+class Chunk;
+class Table;
+
+// Marks how a column is stored in a binary file
+enum class BinaryColumnEncoding : uint8_t { Value, Dictionary };
+
+// ExportBinary writes a table to a file in our binary format, which ImportBinary loads without parsing any values.
+//
+// The file starts with a header, followed by the chunks of the table. Every chunk holds one block per column.
+// All numbers are stored in the byte order of the machine. Arrays (marked with []) start at an offset that is a
+// multiple of 8 bytes, so that they can be copied (or read in place) with a single memcpy.
+//
+//   Header:
+//     char[8]      magic number "OPOSSUMB" (see BINARY_FORMAT_MAGIC)
+//     uint32_t     version (see BINARY_FORMAT_VERSION)
+//     uint32_t     chunk size of the table (0 means unlimited)
+//     uint32_t     number of chunks
+//     uint16_t     number of columns
+//     string       type of every column, e.g., "int"
+//     uint8_t      for every column: 1 if it is nullable, 0 otherwise
+//     string       name of every column
+//
+//   Chunk:
+//     uint32_t     number of rows
+//     column       every column of the chunk
+//
+//   Column:
+//     uint8_t      encoding (see BinaryColumnEncoding)
+//     values       for value columns: all values of the column
+//     uint64_t[]   for value columns of nullable columns: the words of the null bitmap (see NullBitmap)
+//     dictionary   for dictionary columns (NULLs are represented by the ValueID that equals the dictionary size):
+//       uint32_t     number of values in the dictionary
+//       values       the dictionary
+//       uint8_t      width of the attribute vector in bytes (1, 2, or 4), or 0 if it is bit-packed
+//       uint8_t      only if bit-packed: number of bits per value id
+//       uint32_t     only if bit-packed: number of words
+//       T[]          the value ids (uint8_t, uint16_t, or uint32_t), or the 64 bit words if bit-packed
+//
+//   Values:
+//     T[]          for numerical types: the values
+//     uint32_t[]   for strings: the length of every string
+//     char[]       for strings: the characters of all strings, without terminating null characters
+//
+//   String:
+//     uint32_t     length
+//     char[]       characters (without alignment)
+//
+// Columns that reference other tables (see ReferenceColumn) are written as value columns.
+class ExportBinary : private Noncopyable {
+ public:
+  ExportBinary(const std::shared_ptr<const Table> table, const std::string& filename);
+
+  // writes the table to the file
+  void execute() const;
+
+ protected:
+  void _write_chunk(std::ofstream& file, const Chunk& chunk) const;
+
+  template <typename T>
+  void _write_column(std::ofstream& file, const BaseColumn& column, const ChunkOffset row_count,
+                     const bool nullable) const;
+
+  static void _write_attribute_vector(std::ofstream& file, const BaseAttributeVector& attribute_vector,
+                                      const ChunkOffset row_count);
+
+  const std::shared_ptr<const Table> _table;
+  const std::string _filename;
+};
+
+// the magic number and the version that every binary file starts with
+constexpr char BINARY_FORMAT_MAGIC[8] = {'O', 'P', 'O', 'S', 'S', 'U', 'M', 'B'};
+constexpr uint32_t BINARY_FORMAT_VERSION = 2;
+
+// arrays in binary files start at offsets that are multiples of this
+constexpr size_t BINARY_FORMAT_ALIGNMENT = 8;
+
+}  // namespace opossum
@@ -0,0 +1,205 @@
+#include "import_binary.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "export_binary.hpp"
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/null_bitmap.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/string_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Reads the elements of the binary format (see export_binary.hpp) from a mapped file
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, const size_t size) : _data{data}, _size{size} {}
+
+  template <typename T>
+  T read_value() {
+    T value;
+    std::memcpy(&value, _advance(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read_value<uint32_t>();
+    return std::string(_advance(length), length);
+  }
+
+  // reads count elements that start at an aligned offset
+  template <typename T>
+  pmr_vector<T> read_array(const size_t count) {
+    _offset += (BINARY_FORMAT_ALIGNMENT - _offset % BINARY_FORMAT_ALIGNMENT) % BINARY_FORMAT_ALIGNMENT;
+    pmr_vector<T> values(count);
+    const auto data = _advance(count * sizeof(T));
+    if (count > 0) std::memcpy(values.data(), data, count * sizeof(T));
+    return values;
+  }
+
+  // reads the values of a value column or a dictionary
+  template <typename T>
+  pmr_vector<T> read_values(const size_t count) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      const auto lengths = read_array<uint32_t>(count);
+      pmr_vector<std::string> values(count);
+      for (size_t index = 0; index < count; ++index) {
+        values[index].assign(_advance(lengths[index]), lengths[index]);
+      }
+      return values;
+    } else {
+      return read_array<T>(count);
+    }
+  }
+
+  // reads the values of a string value column into a single buffer
+  StringVector read_string_vector(const size_t count) {
+    const auto lengths = read_array<uint32_t>(count);
+    auto char_count = size_t{0};
+    for (const auto length : lengths) char_count += length;
+
+    StringVector values;
+    values.reserve(count, char_count);
+    for (const auto length : lengths) values.push_back(std::string_view{_advance(length), length});
+    return values;
+  }
+
+  bool at_end() const { return _offset == _size; }
+
+ private:
+  // returns a pointer to the next byte_count bytes and skips them
+  const char* _advance(const size_t byte_count) {
+    // called for every string, so the message is only built on failure
+    if (byte_count > _size - _offset) Fail("Unexpected end of file");
+    const auto data = _data + _offset;
+    _offset += byte_count;
+    return data;
+  }
+
+  const char* _data;
+  size_t _size;
+  size_t _offset = 0;
+};
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(BinaryReader& reader, const ChunkOffset row_count) {
+  const auto width = reader.read_value<AttributeVectorWidth>();
+  switch (width) {
+    case 0: {
+      const auto bit_width = reader.read_value<uint8_t>();
+      const auto word_count = reader.read_value<uint32_t>();
+      return std::make_shared<BitPackedAttributeVector>(row_count, bit_width, reader.read_array<uint64_t>(word_count));
+    }
+    case 1:
+      return std::make_shared<FittedAttributeVector<uint8_t>>(reader.read_array<uint8_t>(row_count));
+    case 2:
+      return std::make_shared<FittedAttributeVector<uint16_t>>(reader.read_array<uint16_t>(row_count));
+    case 4:
+      return std::make_shared<FittedAttributeVector<uint32_t>>(reader.read_array<uint32_t>(row_count));
+  }
+  Fail("Invalid attribute vector width " + std::to_string(width));
+  return nullptr;
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_column(BinaryReader& reader, const ChunkOffset row_count, const bool nullable) {
+  const auto encoding = reader.read_value<BinaryColumnEncoding>();
+  switch (encoding) {
+    case BinaryColumnEncoding::Value: {
+      auto values = ValueVector<T>{};
+      if constexpr (std::is_same<T, std::string>::value) {
+        values = reader.read_string_vector(row_count);
+      } else {
+        values = reader.read_values<T>(row_count);
+      }
+      if (!nullable) return std::make_shared<ValueColumn<T>>(std::move(values));
+      auto null_values = NullBitmap{row_count, reader.read_array<uint64_t>(NullBitmap::word_count(row_count))};
+      return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
+    }
+    case BinaryColumnEncoding::Dictionary: {
+      const auto dictionary_size = reader.read_value<uint32_t>();
+      auto dictionary = std::make_shared<pmr_vector<T>>(reader.read_values<T>(dictionary_size));
+      auto attribute_vector = read_attribute_vector(reader, row_count);
+
+      // the dictionary column does not check its value ids on access, so they are validated once here
+      const auto value_id_count = size_t{dictionary_size} + (nullable ? 1u : 0u);
+      resolve_attribute_vector_type(*attribute_vector, [&](const auto& typed_attribute_vector) {
+        for (ChunkOffset chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+          const auto value_id = static_cast<ValueID::base_type>(typed_attribute_vector.get(chunk_offset));
+          if (value_id >= value_id_count) Fail("Invalid value id in dictionary column");
+        }
+      });
+      return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector), nullable);
+    }
+  }
+  Fail("Invalid column encoding");
+  return nullptr;
+}
+
+}  // namespace
+
+ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string>& table_name)
+    : _filename{filename}, _table_name{table_name} {}
+
+std::shared_ptr<Table> ImportBinary::execute() const {
+  const MappedFile file{_filename};
+  BinaryReader reader{file.data(), file.size()};
+
+  char magic[sizeof(BINARY_FORMAT_MAGIC)];
+  for (auto& character : magic) character = reader.read_value<char>();
+  Assert(std::memcmp(magic, BINARY_FORMAT_MAGIC, sizeof(magic)) == 0, _filename + " is not a binary table file");
+  Assert(reader.read_value<uint32_t>() == BINARY_FORMAT_VERSION, "Unsupported version of the binary format");
+
+  const auto chunk_size = reader.read_value<uint32_t>();
+  const auto chunk_count = reader.read_value<ChunkID::base_type>();
+  const auto column_count = reader.read_value<uint16_t>();
+
+  std::vector<std::string> column_types(column_count);
+  for (auto& column_type : column_types) column_type = reader.read_string();
+  std::vector<bool> column_nullable(column_count);
+  for (size_t column_id = 0; column_id < column_count; ++column_id) {
+    column_nullable[column_id] = reader.read_value<uint8_t>() != 0;
+  }
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (size_t column_id = 0; column_id < column_count; ++column_id) {
+    table->add_column_definition(reader.read_string(), column_types[column_id], column_nullable[column_id]);
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto row_count = reader.read_value<ChunkOffset>();
+
+    auto chunk = std::make_shared<Chunk>();
+    for (size_t column_id = 0; column_id < column_count; ++column_id) {
+      resolve_data_type(column_types[column_id], [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        chunk->add_column(read_column<ColumnDataType>(reader, row_count, column_nullable[column_id]));
+      });
+    }
+    // empty chunks, e.g., the last chunk of the exported table, are left out
+    if (row_count > 0) table->emplace_chunk(chunk);
+  }
+  Assert(reader.at_end(), "Unexpected data at the end of " + _filename);
+
+  if (_table_name) StorageManager::get().add_table(*_table_name, table);
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Table;
+
+// ImportBinary loads a table that has been written by ExportBinary (see there for the file format).
+//
+// The file is mapped into memory, so that the values of every column are copied into their vectors with a single
+// memcpy each instead of being parsed. Dictionary-encoded columns stay encoded. The loaded chunks are complete,
+// i.e., they have statistics and further inserts go to a new chunk (see Table::emplace_chunk).
+class ImportBinary : private Noncopyable {
+ public:
+  // if a table name is given, the table is added to the StorageManager under this name
+  explicit ImportBinary(const std::string& filename, const std::optional<std::string>& table_name = std::nullopt);
+
+  // loads the table from the file
+  std::shared_ptr<Table> execute() const;
+
+ protected:
+  const std::string _filename;
+  const std::optional<std::string> _table_name;
+};
+
+}  // namespace opossum
@@ -0,0 +1,252 @@
+#include "import_csv.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the approximate size of the blocks that are parsed by one job
+constexpr size_t CSV_BLOCK_SIZE = 4 * 1024 * 1024;
+
+// the number of blocks per worker that may be parsed before they are appended to the table
+constexpr size_t CSV_BLOCKS_IN_FLIGHT_PER_WORKER = 2;
+
+// the suffix of the types of nullable columns, e.g., "int_null"
+constexpr std::string_view CSV_NULLABLE_SUFFIX = "_null";
+
+// The fields of a block of lines, column by column. Fields refer to the mapped file, unless they contained escaped
+// quotes, in which case they refer to their unescaped copies. Empty fields that are not quoted do not refer to any
+// data at all (i.e., data() is nullptr), so that they can be told apart from empty strings ("").
+struct CsvFields {
+  std::vector<std::vector<std::string_view>> columns;
+  std::deque<std::string> unescaped_fields;
+};
+
+// Splits the lines in [begin, end) into fields and appends them to fields.columns, which has one entry per column
+void split_lines(const char* begin, const char* const end, const char delimiter, CsvFields& fields) {
+  const auto column_count = fields.columns.size();
+
+  while (begin != end) {
+    const auto line_end = std::find(begin, end, '\n');
+    const auto content_end = line_end != begin && *(line_end - 1) == '\r' ? line_end - 1 : line_end;
+    const auto line = std::string_view(begin, static_cast<size_t>(content_end - begin));
+    auto field_begin = begin;
+    begin = line_end == end ? end : line_end + 1;
+    if (line.empty()) continue;
+
+    size_t column_id = 0;
+    while (true) {
+      if (column_id == column_count) Fail("Too many fields in line '" + std::string(line) + "'");
+
+      std::string_view field;
+      auto field_end = field_begin;
+      if (field_begin != content_end && *field_begin == '"') {
+        // a quoted field ends at the first quote that is not followed by another one
+        auto has_escaped_quotes = false;
+        field_end = field_begin + 1;
+        while (true) {
+          field_end = std::find(field_end, content_end, '"');
+          if (field_end == content_end) Fail("Unterminated quoted field in line '" + std::string(line) + "'");
+          if (field_end + 1 == content_end || *(field_end + 1) != '"') break;
+          has_escaped_quotes = true;
+          field_end += 2;
+        }
+
+        field = std::string_view(field_begin + 1, static_cast<size_t>(field_end - field_begin - 1));
+        if (has_escaped_quotes) {
+          auto& unescaped_field = fields.unescaped_fields.emplace_back();
+          for (size_t index = 0; index < field.size(); ++index) {
+            unescaped_field.push_back(field[index]);
+            if (field[index] == '"') ++index;
+          }
+          field = unescaped_field;
+        }
+
+        ++field_end;
+        if (field_end != content_end && *field_end != delimiter) {
+          Fail("Unexpected characters after quoted field in line '" + std::string(line) + "'");
+        }
+      } else {
+        field_end = std::find(field_begin, content_end, delimiter);
+        if (field_end != field_begin) {
+          field = std::string_view(field_begin, static_cast<size_t>(field_end - field_begin));
+        }
+      }
+
+      fields.columns[column_id++].push_back(field);
+      if (field_end == content_end) break;
+      field_begin = field_end + 1;
+    }
+    if (column_id != column_count) Fail("Too few fields in line '" + std::string(line) + "'");
+  }
+}
+
+// Converts the fields of a column into a value column. In nullable columns, empty fields that are not quoted are NULL.
+template <typename T>
+std::shared_ptr<BaseColumn> parse_column(const std::vector<std::string_view>& fields, const std::string& column_name,
+                                         const bool nullable) {
+  ValueVector<T> values;
+  if constexpr (std::is_same<T, std::string>::value) {
+    // all strings of the column end up in one buffer
+    auto char_count = size_t{0};
+    for (const auto& field : fields) char_count += field.size();
+    values.reserve(fields.size(), char_count);
+  } else {
+    values.resize(fields.size());
+  }
+  auto null_values = nullable ? std::optional<NullBitmap>{fields.size()} : std::nullopt;
+
+  for (size_t index = 0; index < fields.size(); ++index) {
+    const auto& field = fields[index];
+    const auto is_null = nullable && !field.data();
+    if (is_null) null_values->set_null(index, true);
+
+    if constexpr (std::is_same<T, std::string>::value) {
+      values.push_back(field);
+    } else if (!is_null) {
+      const auto field_end = field.data() + field.size();
+      const auto [parsed_end, error] = std::from_chars(field.data(), field_end, values[index]);
+      if (error != std::errc{} || parsed_end != field_end) {
+        Fail("Invalid value '" + std::string(field) + "' in column " + column_name);
+      }
+    }
+  }
+
+  if (null_values) return std::make_shared<ValueColumn<T>>(std::move(values), std::move(*null_values));
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+// Returns whether the type string names one of the supported column types, e.g., "int"
+bool is_column_type(const std::string& type) {
+  auto found = false;
+  hana::for_each(column_types, [&](auto column_type) { found |= std::string(hana::first(column_type)) == type; });
+  return found;
+}
+
+// Returns the number of fields in the line that starts at begin, not counting delimiters within quoted fields.
+// escaped quotes ("") toggle the quoting twice and do not need to be treated separately
+size_t count_fields(const char* begin, const char* const end, const char delimiter) {
+  const auto line_end = std::find(begin, end, '\n');
+  auto quoted = false;
+  size_t field_count = 1;
+  for (; begin != line_end; ++begin) {
+    if (*begin == '"') {
+      quoted = !quoted;
+    } else if (*begin == delimiter && !quoted) {
+      ++field_count;
+    }
+  }
+  return field_count;
+}
+
+// Splits a header line into its fields
+std::vector<std::string> parse_header_line(const char*& begin, const char* const end, const char delimiter,
+                                           const size_t column_count) {
+  const auto line_end = std::find(begin, end, '\n');
+  CsvFields fields;
+  fields.columns.resize(column_count);
+  split_lines(begin, line_end, delimiter, fields);
+  begin = line_end == end ? end : line_end + 1;
+
+  std::vector<std::string> values;
+  for (const auto& column : fields.columns) {
+    if (column.size() != 1) Fail("Invalid CSV header");
+    values.emplace_back(column.front());
+  }
+  return values;
+}
+
+}  // namespace
+
+ImportCsv::ImportCsv(const std::string& filename, const std::string& table_name, const uint32_t chunk_size,
+                     const char delimiter)
+    : _filename{filename}, _table_name{table_name}, _chunk_size{chunk_size}, _delimiter{delimiter} {}
+
+std::shared_ptr<Table> ImportCsv::execute() const {
+  const MappedFile file{_filename};
+  auto begin = file.data();
+  const auto end = file.data() + file.size();
+
+  // the number of columns is given by the number of fields in the first line
+  const auto column_count = count_fields(begin, end, _delimiter);
+  const auto column_names = parse_header_line(begin, end, _delimiter, column_count);
+  auto column_types = parse_header_line(begin, end, _delimiter, column_count);
+
+  auto table = std::make_shared<Table>(_chunk_size);
+  std::vector<bool> column_nullable(column_count);
+  for (size_t column_id = 0; column_id < column_count; ++column_id) {
+    auto& column_type = column_types[column_id];
+    if (column_type.size() > CSV_NULLABLE_SUFFIX.size() &&
+        std::string_view(column_type).substr(column_type.size() - CSV_NULLABLE_SUFFIX.size()) == CSV_NULLABLE_SUFFIX) {
+      column_nullable[column_id] = true;
+      column_type.resize(column_type.size() - CSV_NULLABLE_SUFFIX.size());
+    }
+
+    // the file is user input, so the types are checked in release builds as well
+    Assert(is_column_type(column_type), "Unknown column type " + column_type);
+    table->add_column(column_names[column_id], column_type, column_nullable[column_id]);
+  }
+
+  const auto worker_count = CurrentScheduler::is_set() ? CurrentScheduler::get()->worker_count() : size_t{1};
+  const auto blocks_in_flight = CSV_BLOCKS_IN_FLIGHT_PER_WORKER * std::max(worker_count, size_t{1});
+
+  while (begin != end) {
+    // every block ends after a line break (or at the end of the file)
+    std::vector<std::pair<const char*, const char*>> blocks;
+    while (begin != end && blocks.size() < blocks_in_flight) {
+      auto block_end = begin + std::min(CSV_BLOCK_SIZE, static_cast<size_t>(end - begin));
+      block_end = std::find(block_end, end, '\n');
+      if (block_end != end) ++block_end;
+      blocks.emplace_back(begin, block_end);
+      begin = block_end;
+    }
+
+    std::vector<std::vector<std::shared_ptr<BaseColumn>>> block_columns(blocks.size());
+    std::vector<std::shared_ptr<JobTask>> jobs;
+    for (size_t block_id = 0; block_id < blocks.size(); ++block_id) {
+      jobs.push_back(std::make_shared<JobTask>([&, block_id]() {
+        CsvFields fields;
+        fields.columns.resize(column_count);
+        split_lines(blocks[block_id].first, blocks[block_id].second, _delimiter, fields);
+
+        for (size_t column_id = 0; column_id < column_count; ++column_id) {
+          resolve_data_type(column_types[column_id], [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            block_columns[block_id].push_back(parse_column<ColumnDataType>(
+                fields.columns[column_id], column_names[column_id], column_nullable[column_id]));
+          });
+        }
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    for (const auto& columns : block_columns) {
+      table->append_columns(columns);
+    }
+  }
+
+  StorageManager::get().add_table(_table_name, table);
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Table;
+
+// ImportCsv loads a CSV file into a new table and adds it to the StorageManager.
+//
+// The first line of the file holds the column names, the second line their types (e.g., "int" or "string"), and every
+// further line a row. Fields are separated by the delimiter and may be enclosed in double quotes, in which case they
+// may contain the delimiter and escaped quotes (""), but no line breaks.
+// Columns whose type carries the suffix "_null" (e.g., "int_null") are nullable. In these, empty fields are NULL,
+// unless they are quoted, i.e., "" is an empty string.
+//
+// The file is mapped into memory and split into blocks of whole lines. Every block is parsed by a job of its own (see
+// CurrentScheduler): its lines are split into fields first, then every column is converted at once into a typed
+// vector, using std::from_chars for numbers. The blocks are appended to the table in the order of the file, which
+// distributes their rows over chunks of the given size (see Table::append_columns). Only a limited number of blocks
+// is parsed ahead of the table, so memory does not grow with the size of the file.
+class ImportCsv : private Noncopyable {
+ public:
+  ImportCsv(const std::string& filename, const std::string& table_name, const uint32_t chunk_size = 0,
+            const char delimiter = ',');
+
+  // loads the file and returns the table
+  std::shared_ptr<Table> execute() const;
+
+ protected:
+  const std::string _filename;
+  const std::string _table_name;
+  const uint32_t _chunk_size;
+  const char _delimiter;
+};
+
+}  // namespace opossum
@@ -0,0 +1,234 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/mix_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the radix partitioning aims at hash tables of at most this size, i.e., roughly the size of the L2 cache
+constexpr size_t TARGET_PARTITION_BYTES = 256 * 1024;
+
+// more partitions would make the partitioning itself thrash the TLB
+constexpr uint8_t MAX_RADIX_BITS = 10;
+
+// marks the end of a chain of build side elements with the same value, and empty slots of the hash table
+constexpr size_t END_OF_CHAIN = std::numeric_limits<size_t>::max();
+
+// the number of probe elements whose slots are looked up together, see join_partition
+constexpr size_t PROBE_BATCH_SIZE = 16;
+
+// strings are joined as string_views into the input columns, which outlive the join
+template <typename T>
+using JoinKey = typename ColumnIteratorValue<T>::ValueType;
+
+template <typename T>
+struct JoinElement {
+  JoinKey<T> value;
+  RowID row_id;
+};
+
+// std::hash is the identity for integers, so its low bits would put values that only differ in their high bits into
+// the same partition and slot
+template <typename T>
+uint64_t hash_value(const JoinKey<T>& value) {
+  return mix_hash(std::hash<JoinKey<T>>{}(value));
+}
+
+// Reads the join column of all chunks into a flat list of values and their positions, leaving out NULLs
+template <typename T>
+std::vector<JoinElement<T>> materialize(const Table& table, const ColumnID column_id) {
+  std::vector<JoinElement<T>> elements;
+  elements.reserve(table.row_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    // rows that are appended concurrently are not visible yet and must not be joined
+    const auto chunk_size = chunk.size();
+    if (chunk_size == 0) continue;
+
+    const auto column = chunk.get_column(column_id);
+    resolve_column_type<T>(*column, [&](const auto& typed_column) {
+      create_iterable_from_column<T>(typed_column, chunk_size).with_iterators([&](auto it, auto end) {
+        for (; it != end; ++it) {
+          // NULL is not equal to any value, so it never finds a join partner
+          if (it->is_null()) continue;
+          elements.push_back(JoinElement<T>{it->value(), RowID{chunk_id, it->chunk_offset()}});
+        }
+      });
+    });
+  }
+
+  return elements;
+}
+
+// Partitions the elements by the lowest radix_bits bits of their hash. Returns the partitioned elements and the
+// offsets of the partitions within them (with an additional entry for the end of the last partition).
+template <typename T>
+std::pair<std::vector<JoinElement<T>>, std::vector<size_t>> radix_partition(std::vector<JoinElement<T>>&& elements,
+                                                                            const uint8_t radix_bits) {
+  const auto partition_count = size_t{1} << radix_bits;
+  if (partition_count == 1) {
+    auto partition_offsets = std::vector<size_t>{0, elements.size()};
+    return {std::move(elements), std::move(partition_offsets)};
+  }
+
+  const auto mask = partition_count - 1;
+
+  // the first pass computes a histogram of the partition sizes and remembers the partition of each element
+  std::vector<size_t> partition_offsets(partition_count + 1);
+  std::vector<uint32_t> partition_ids(elements.size());
+  for (size_t index = 0; index < elements.size(); ++index) {
+    const auto partition_id = static_cast<uint32_t>(hash_value<T>(elements[index].value) & mask);
+    partition_ids[index] = partition_id;
+    ++partition_offsets[partition_id + 1];
+  }
+  std::partial_sum(partition_offsets.cbegin(), partition_offsets.cend(), partition_offsets.begin());
+
+  // the second pass scatters the elements into their partitions
+  std::vector<JoinElement<T>> partitioned(elements.size());
+  auto write_offsets = partition_offsets;
+  for (size_t index = 0; index < elements.size(); ++index) {
+    partitioned[write_offsets[partition_ids[index]]++] = std::move(elements[index]);
+  }
+
+  return {std::move(partitioned), std::move(partition_offsets)};
+}
+
+// Joins one partition of the build side with the matching partition of the probe side. The lowest radix_bits bits of
+// the hashes are the same for all elements of the partition, so the hash table uses the bits above them.
+template <typename T>
+void join_partition(const JoinElement<T>* build_begin, const JoinElement<T>* build_end,
+                    const JoinElement<T>* probe_begin, const JoinElement<T>* probe_end, const uint8_t radix_bits,
+                    PosList& build_pos_list, PosList& probe_pos_list) {
+  if (build_begin == build_end || probe_begin == probe_end) return;
+
+  // The hash table uses open addressing with linear probing. A slot holds the index of the last build element with
+  // its value, elements with the same value are chained via their indices. That way, building the table does not
+  // allocate per distinct value. At most half of the slots are used, so that the probe sequences stay short.
+  const auto build_size = static_cast<size_t>(build_end - build_begin);
+  auto slot_count = size_t{1};
+  while (slot_count < 2 * build_size) slot_count <<= 1;
+  const auto slot_mask = slot_count - 1;
+  std::vector<size_t> slots(slot_count, END_OF_CHAIN);
+  std::vector<size_t> chain_next(build_size);
+
+  for (size_t index = 0; index < build_size; ++index) {
+    const auto& value = build_begin[index].value;
+    auto slot = (hash_value<T>(value) >> radix_bits) & slot_mask;
+    while (slots[slot] != END_OF_CHAIN && build_begin[slots[slot]].value != value) slot = (slot + 1) & slot_mask;
+    chain_next[index] = std::exchange(slots[slot], index);
+  }
+
+  // The probe side is processed in batches: the slots of all elements of a batch are computed and prefetched before
+  // the first one is looked up, so that their cache misses overlap instead of stalling each lookup.
+  const auto probe_size = static_cast<size_t>(probe_end - probe_begin);
+  std::array<size_t, PROBE_BATCH_SIZE> probe_slots;
+  for (size_t batch_begin = 0; batch_begin < probe_size; batch_begin += PROBE_BATCH_SIZE) {
+    const auto batch = probe_begin + batch_begin;
+    const auto batch_size = std::min(PROBE_BATCH_SIZE, probe_size - batch_begin);
+
+    for (size_t batch_index = 0; batch_index < batch_size; ++batch_index) {
+      probe_slots[batch_index] = (hash_value<T>(batch[batch_index].value) >> radix_bits) & slot_mask;
+      __builtin_prefetch(&slots[probe_slots[batch_index]]);
+    }
+
+    for (size_t batch_index = 0; batch_index < batch_size; ++batch_index) {
+      const auto& probe_element = batch[batch_index];
+      auto slot = probe_slots[batch_index];
+      while (slots[slot] != END_OF_CHAIN && build_begin[slots[slot]].value != probe_element.value) {
+        slot = (slot + 1) & slot_mask;
+      }
+
+      for (auto index = slots[slot]; index != END_OF_CHAIN; index = chain_next[index]) {
+        build_pos_list.push_back(build_begin[index].row_id);
+        probe_pos_list.push_back(probe_element.row_id);
+      }
+    }
+  }
+}
+
+// chooses the number of radix bits so that the hash table of a partition fits into TARGET_PARTITION_BYTES
+template <typename T>
+uint8_t choose_radix_bits(const size_t build_size) {
+  // besides the element itself, each entry costs up to four slots (see join_partition) and a chain link
+  constexpr size_t bytes_per_element = sizeof(JoinElement<T>) + 5 * sizeof(size_t);
+
+  uint8_t radix_bits = 0;
+  while (radix_bits < MAX_RADIX_BITS && (build_size >> radix_bits) * bytes_per_element > TARGET_PARTITION_BYTES) {
+    ++radix_bits;
+  }
+  return radix_bits;
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
+                   const ColumnID left_column_id, const ColumnID right_column_id,
+                   const std::optional<uint8_t> radix_bits)
+    : _left{left},
+      _right{right},
+      _left_column_id{left_column_id},
+      _right_column_id{right_column_id},
+      _radix_bits{radix_bits} {
+  Assert(left->column_type(left_column_id) == right->column_type(right_column_id),
+         "Join columns have to be of the same type");
+  Assert(!radix_bits || *radix_bits <= MAX_RADIX_BITS, "Too many radix bits");
+}
+
+std::pair<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>> JoinHash::execute() const {
+  std::pair<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>> result;
+
+  resolve_data_type(_left->column_type(_left_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    result = _execute<ColumnDataType>();
+  });
+
+  return result;
+}
+
+template <typename T>
+std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>> JoinHash::_execute() const {
+  auto left_elements = materialize<T>(*_left, _left_column_id);
+  auto right_elements = materialize<T>(*_right, _right_column_id);
+
+  // the hash table is built on the smaller side
+  const auto build_left = left_elements.size() <= right_elements.size();
+  auto& build_elements = build_left ? left_elements : right_elements;
+  auto& probe_elements = build_left ? right_elements : left_elements;
+
+  const auto radix_bits = _radix_bits ? *_radix_bits : choose_radix_bits<T>(build_elements.size());
+  const auto [build_partitions, build_offsets] = radix_partition(std::move(build_elements), radix_bits);
+  const auto [probe_partitions, probe_offsets] = radix_partition(std::move(probe_elements), radix_bits);
+
+  auto build_pos_list = std::make_shared<PosList>();
+  auto probe_pos_list = std::make_shared<PosList>();
+
+  for (size_t partition_id = 0; partition_id + 1 < build_offsets.size(); ++partition_id) {
+    join_partition(build_partitions.data() + build_offsets[partition_id],
+                   build_partitions.data() + build_offsets[partition_id + 1],
+                   probe_partitions.data() + probe_offsets[partition_id],
+                   probe_partitions.data() + probe_offsets[partition_id + 1], radix_bits, *build_pos_list,
+                   *probe_pos_list);
+  }
+
+  if (build_left) return {build_pos_list, probe_pos_list};
+  return {probe_pos_list, build_pos_list};
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// JoinHash computes the equi-join of two tables on one column each. It returns two position lists of equal length:
+// the i-th position of the left list and the i-th position of the right list form a matching pair of rows.
+//
+// The hash table is built on the smaller input and probed with the larger one, in batches of rows whose lookups
+// overlap. For large inputs, both sides are radix partitioned by the hash of their values first, so that the hash
+// table of each partition fits into the cache.
+// Values are read through the column iterables, i.e., without AllTypeVariant conversions.
+// To pass on the result, use make_reference_table (see reference_column.hpp) on each side.
+class JoinHash : private Noncopyable {
+ public:
+  // both columns have to be of the same type
+  // radix_bits determines the number of partitions (2^radix_bits). If it is not given, it is chosen depending on the
+  // size of the smaller input
+  JoinHash(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
+           const ColumnID left_column_id, const ColumnID right_column_id,
+           const std::optional<uint8_t> radix_bits = std::nullopt);
+
+  // runs the join and returns the matching positions of the left and the right table
+  std::pair<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>> execute() const;
+
+ protected:
+  template <typename T>
+  std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>> _execute() const;
+
+  const std::shared_ptr<const Table> _left;
+  const std::shared_ptr<const Table> _right;
+  const ColumnID _left_column_id;
+  const ColumnID _right_column_id;
+  const std::optional<uint8_t> _radix_bits;
+};
+
+}  // namespace opossum
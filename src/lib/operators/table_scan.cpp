@@ -0,0 +1,354 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cast_predicate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk_statistics.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/null_bitmap.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/reference_column_iterable.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the number of rows whose comparison results are buffered before their positions are collected
+constexpr ChunkOffset SCAN_BLOCK_SIZE = 1024;
+
+// indices are only used if at most this fraction of the chunk's rows match. Otherwise, scanning the column is faster
+// than sorting the positions that the index returns.
+constexpr double INDEX_SCAN_MAX_SELECTIVITY = 0.1;
+
+// Resolves a scan type by passing the matching comparison functor on to a generic lambda
+template <typename Functor>
+void resolve_scan_type(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+  }
+  Fail("Unknown scan type");
+}
+
+// Appends the positions of all rows in [0, chunk_size) that satisfy the predicate.
+// The predicate is first evaluated for a block of rows without any branches, so that the compiler can vectorize
+// the loop. Only then are the positions of the matching rows collected.
+template <typename Predicate>
+void append_matches(const ChunkID chunk_id, const ChunkOffset chunk_size, const Predicate& predicate,
+                    PosList& pos_list) {
+  std::array<uint8_t, SCAN_BLOCK_SIZE> matches;
+
+  for (ChunkOffset block_begin = 0; block_begin < chunk_size; block_begin += SCAN_BLOCK_SIZE) {
+    const auto block_size = std::min(SCAN_BLOCK_SIZE, chunk_size - block_begin);
+
+    for (ChunkOffset i = 0; i < block_size; ++i) {
+      matches[i] = predicate(block_begin + i);
+    }
+
+    for (ChunkOffset i = 0; i < block_size; ++i) {
+      if (matches[i]) pos_list.push_back(RowID{chunk_id, block_begin + i});
+    }
+  }
+}
+
+// Same as append_matches, but leaves out NULLs. The comparison results are collected word by word of the null bitmap:
+// words that consist of NULLs only are skipped at once, and the bits of the other words are only looked at for rows
+// that match.
+template <typename Predicate>
+void append_non_null_matches(const ChunkID chunk_id, const ChunkOffset chunk_size, const NullBitmap& null_values,
+                             const Predicate& predicate, PosList& pos_list) {
+  static_assert(SCAN_BLOCK_SIZE % NullBitmap::BITS_PER_WORD == 0, "Blocks have to consist of whole words");
+  constexpr auto bits_per_word = static_cast<ChunkOffset>(NullBitmap::BITS_PER_WORD);
+  const auto& null_words = null_values.words();
+  std::array<uint8_t, SCAN_BLOCK_SIZE> matches;
+
+  for (ChunkOffset block_begin = 0; block_begin < chunk_size; block_begin += SCAN_BLOCK_SIZE) {
+    const auto block_size = std::min(SCAN_BLOCK_SIZE, chunk_size - block_begin);
+
+    for (ChunkOffset i = 0; i < block_size; ++i) {
+      matches[i] = predicate(block_begin + i);
+    }
+
+    for (ChunkOffset word_begin = 0; word_begin < block_size; word_begin += bits_per_word) {
+      const auto nulls = null_words[(block_begin + word_begin) / bits_per_word];
+      if (nulls == ~uint64_t{0}) continue;
+
+      const auto word_end = std::min(word_begin + bits_per_word, block_size);
+      for (auto i = word_begin; i < word_end; ++i) {
+        if (matches[i] && !((nulls >> (i - word_begin)) & 1u)) pos_list.push_back(RowID{chunk_id, block_begin + i});
+      }
+    }
+  }
+}
+
+void append_all(const ChunkID chunk_id, const ChunkOffset chunk_size, PosList& pos_list) {
+  pos_list.reserve(pos_list.size() + chunk_size);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+    pos_list.push_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const Table> table, const ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : _table{table}, _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const PosList> TableScan::execute() const {
+  // every chunk is scanned by a job of its own, the results are concatenated in the order of the chunks
+  const auto chunk_count = _table->chunk_count();
+  std::vector<PosList> chunk_pos_lists(chunk_count);
+
+  resolve_data_type(_table->column_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    // the search value is cast to the column type once, adjusting the predicate where the cast is not exact (e.g.,
+    // "< 2.5" on an int column becomes "<= 2"). Predicates that no value can satisfy (e.g., comparisons with NULL) do
+    // not need to look at any chunk.
+    const auto predicate = cast_predicate<ColumnDataType>(_scan_type, _search_value);
+    if (!predicate) return;
+    const auto scan_type = predicate->scan_type;
+    const auto& search_value = predicate->value;
+
+    std::vector<std::shared_ptr<JobTask>> jobs;
+    jobs.reserve(chunk_count);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = _table->get_chunk(chunk_id);
+      // rows that are appended concurrently are not visible yet and must not be scanned
+      const auto chunk_size = chunk.size();
+      if (chunk_size == 0) continue;
+
+      // skip chunks whose value range cannot match
+      const auto statistics = chunk.statistics();
+      if (statistics && statistics->can_prune(_column_id, scan_type, search_value)) continue;
+
+      jobs.push_back(std::make_shared<JobTask>([&, chunk_id, chunk_size]() {
+        auto& chunk_pos_list = chunk_pos_lists[chunk_id];
+        const auto indices = chunk.get_indices({_column_id});
+        if (!indices.empty() && _scan_index(*indices.front(), chunk_id, chunk_size, scan_type, search_value,
+                                            chunk_pos_list)) {
+          return;
+        }
+
+        const auto column = chunk.get_column(_column_id);
+        resolve_column_type<ColumnDataType>(*column, [&](const auto& typed_column) {
+          _scan_column(typed_column, chunk_id, chunk_size, scan_type, search_value, chunk_pos_list);
+        });
+      }));
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+
+  auto pos_list = std::make_shared<PosList>();
+  if (chunk_count == 1) {
+    *pos_list = std::move(chunk_pos_lists.front());
+    return pos_list;
+  }
+
+  size_t match_count = 0;
+  for (const auto& chunk_pos_list : chunk_pos_lists) match_count += chunk_pos_list.size();
+  pos_list->reserve(match_count);
+  for (const auto& chunk_pos_list : chunk_pos_lists) {
+    pos_list->insert(pos_list->end(), chunk_pos_list.cbegin(), chunk_pos_list.cend());
+  }
+
+  return pos_list;
+}
+
+bool TableScan::_scan_index(const BaseIndex& index, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                            const ScanType scan_type, const AllTypeVariant& search_value, PosList& pos_list) const {
+  auto begin = index.cbegin();
+  auto end = index.cend();
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      begin = index.lower_bound({search_value});
+      end = index.upper_bound({search_value});
+      break;
+    case ScanType::OpNotEquals:
+      // matches almost all rows
+      return false;
+    case ScanType::OpLessThan:
+      end = index.lower_bound({search_value});
+      break;
+    case ScanType::OpLessThanEquals:
+      end = index.upper_bound({search_value});
+      break;
+    case ScanType::OpGreaterThan:
+      begin = index.upper_bound({search_value});
+      break;
+    case ScanType::OpGreaterThanEquals:
+      begin = index.lower_bound({search_value});
+      break;
+  }
+
+  const auto match_count = static_cast<size_t>(std::distance(begin, end));
+  if (match_count > chunk_size * INDEX_SCAN_MAX_SELECTIVITY) return false;
+
+  // the index returns the positions in the order of their values, but the result is sorted by position
+  std::vector<ChunkOffset> chunk_offsets(begin, end);
+  std::sort(chunk_offsets.begin(), chunk_offsets.end());
+
+  pos_list.reserve(pos_list.size() + match_count);
+  for (const auto chunk_offset : chunk_offsets) {
+    pos_list.push_back(RowID{chunk_id, chunk_offset});
+  }
+  return true;
+}
+
+template <typename T>
+void TableScan::_scan_column(const ValueColumn<T>& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                             const ScanType scan_type, const T& search_value, PosList& pos_list) const {
+  const auto& values = column.values();
+
+  const auto scan = [&](const auto& predicate) {
+    if (column.is_nullable()) {
+      append_non_null_matches(chunk_id, chunk_size, column.null_values(), predicate, pos_list);
+    } else {
+      append_matches(chunk_id, chunk_size, predicate, pos_list);
+    }
+  };
+
+  resolve_scan_type(scan_type, [&](auto comparator) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      // the prefixes decide most comparisons without reading the strings (see StringVector)
+      const auto search_prefix = StringVector::make_prefix(search_value);
+      scan([&](const ChunkOffset chunk_offset) {
+        return comparator(values.compare(chunk_offset, search_value, search_prefix), 0);
+      });
+    } else {
+      scan([&](const ChunkOffset chunk_offset) { return comparator(values[chunk_offset], search_value); });
+    }
+  });
+}
+
+template <typename T>
+void TableScan::_scan_column(const DictionaryColumn<T>& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                             const ScanType scan_type, const T& search_value, PosList& pos_list) const {
+  // Translate the predicate on values into a predicate on ValueIDs. As the dictionary is sorted, this is either a
+  // comparison with the lower or upper bound of the search value, or the predicate matches all or no rows at all.
+  const auto lower_bound = column.lower_bound(search_value);
+  const auto upper_bound = column.upper_bound(search_value);
+  // lower_bound == upper_bound if the search value does not occur in the dictionary
+  const auto value_exists = lower_bound != INVALID_VALUE_ID && lower_bound != upper_bound;
+
+  auto scan_value_ids = [&](const auto& value_id_predicate) {
+    resolve_attribute_vector_type(*column.attribute_vector(), [&](const auto& attribute_vector) {
+      append_matches(chunk_id, chunk_size,
+                     [&](const ChunkOffset chunk_offset) {
+                       return value_id_predicate(static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset)));
+                     },
+                     pos_list);
+    });
+  };
+
+  const auto lower_value_id = static_cast<ValueID::base_type>(lower_bound);
+  const auto upper_value_id = static_cast<ValueID::base_type>(upper_bound);
+
+  // NULLs are represented by the ValueID behind the dictionary (see BaseDictionaryColumn), i.e., they are greater than
+  // every bound. Predicates that match all rows or the ValueIDs above a bound have to leave them out, but only if the
+  // column is nullable.
+  const auto nullable = column.is_nullable();
+  const auto null_value_id = static_cast<ValueID::base_type>(column.null_value_id());
+
+  auto scan_all = [&]() {
+    if (nullable) {
+      scan_value_ids([&](const auto value_id) { return value_id != null_value_id; });
+    } else {
+      append_all(chunk_id, chunk_size, pos_list);
+    }
+  };
+
+  auto scan_from = [&](const ValueID::base_type begin_value_id) {
+    if (nullable) {
+      scan_value_ids([&](const auto value_id) { return value_id >= begin_value_id && value_id != null_value_id; });
+    } else {
+      scan_value_ids([&](const auto value_id) { return value_id >= begin_value_id; });
+    }
+  };
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      if (value_exists) scan_value_ids([&](const auto value_id) { return value_id == lower_value_id; });
+      return;
+    case ScanType::OpNotEquals:
+      if (!value_exists) {
+        scan_all();
+      } else if (nullable) {
+        scan_value_ids(
+            [&](const auto value_id) { return value_id != lower_value_id && value_id != null_value_id; });
+      } else {
+        scan_value_ids([&](const auto value_id) { return value_id != lower_value_id; });
+      }
+      return;
+    case ScanType::OpLessThan:
+      if (lower_bound == INVALID_VALUE_ID) {
+        scan_all();
+      } else {
+        scan_value_ids([&](const auto value_id) { return value_id < lower_value_id; });
+      }
+      return;
+    case ScanType::OpLessThanEquals:
+      if (upper_bound == INVALID_VALUE_ID) {
+        scan_all();
+      } else {
+        scan_value_ids([&](const auto value_id) { return value_id < upper_value_id; });
+      }
+      return;
+    case ScanType::OpGreaterThan:
+      if (upper_bound != INVALID_VALUE_ID) scan_from(upper_value_id);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      if (lower_bound != INVALID_VALUE_ID) scan_from(lower_value_id);
+      return;
+  }
+  Fail("Unknown scan type");
+}
+
+template <typename T>
+void TableScan::_scan_column(const ReferenceColumn& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                             const ScanType scan_type, const T& search_value, PosList& pos_list) const {
+  resolve_scan_type(scan_type, [&](auto comparator) {
+    ReferenceColumnIterable<T>{column}.with_iterators([&](auto begin, auto) {
+      append_matches(chunk_id, chunk_size,
+                     [&](const ChunkOffset chunk_offset) {
+                       const auto column_value = *(begin + chunk_offset);
+                       return !column_value.is_null() && comparator(column_value.value(), search_value);
+                     },
+                     pos_list);
+    });
+  });
+}
+
+}  // namespace opossum
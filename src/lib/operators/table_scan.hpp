@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class BaseIndex;
+class ReferenceColumn;
+class Table;
+
+template <typename T>
+class ValueColumn;
+
+template <typename T>
+class DictionaryColumn;
+
+// TableScan compares the values of one column of a table with a constant value
+// and returns the positions of all matching rows.
+//
+// Chunks whose statistics show that they cannot contain matching rows are skipped. Every other chunk is scanned by a
+// job of its own (see CurrentScheduler). If the chunk has an index on the column and only few rows match, the
+// positions are taken from the index. The comparison is resolved once per scan and the column type once per chunk
+// so that the inner loops run on typed data. Value columns are compared directly, dictionary columns by ValueID.
+// As in SQL, comparisons with NULL are never true: rows whose value is NULL never match, and neither does any row if
+// the search value is NULL.
+// The search value may be of another type than the column. It is compared by its value, e.g., "< 2.5" on an int column
+// matches 2, and values beyond the range of the column type match all rows or none (see cast_predicate).
+//
+// The positions refer to the scanned table. To chain operators, wrap them with make_reference_table
+// (see reference_column.hpp). Scanning such a table resolves the values through its reference columns.
+class TableScan : private Noncopyable {
+ public:
+  TableScan(const std::shared_ptr<const Table> table, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+  // runs the scan and returns the positions of all matching rows of the table
+  std::shared_ptr<const PosList> execute() const;
+
+ protected:
+  // appends the matching positions found by the index and returns true, or returns false if the index does not pay
+  // off, e.g., because too many rows match
+  bool _scan_index(const BaseIndex& index, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                   const ScanType scan_type, const AllTypeVariant& search_value, PosList& pos_list) const;
+
+  template <typename T>
+  void _scan_column(const ValueColumn<T>& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                    const ScanType scan_type, const T& search_value, PosList& pos_list) const;
+
+  template <typename T>
+  void _scan_column(const DictionaryColumn<T>& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                    const ScanType scan_type, const T& search_value, PosList& pos_list) const;
+
+  template <typename T>
+  void _scan_column(const ReferenceColumn& column, const ChunkID chunk_id, const ChunkOffset chunk_size,
+                    const ScanType scan_type, const T& search_value, PosList& pos_list) const;
+
+  const std::shared_ptr<const Table> _table;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
@@ -7,11 +7,17 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/base_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
 
 namespace opossum {
@@ -129,4 +135,109 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+namespace detail {
+
+// Adds const to Out if In is const
+template <typename In, typename Out>
+using ConstOutIfConstIn = std::conditional_t<std::is_const<In>::value, const Out, Out>;
+
+}  // namespace detail
+
+/**
+ * Resolves a column by casting it to its concrete type and passing it on to a generic lambda.
+ * The cast happens once per column so that the lambda can work on the typed data without
+ * virtual calls or AllTypeVariant conversions.
+ *
+ * @param ColumnDataType is the data type of the column
+ * @param column is the column that should be resolved. If it is const, the typed column will be const, too
+ * @param func is a generic lambda or similar accepting a reference to ValueColumn<ColumnDataType>,
+ *             DictionaryColumn<ColumnDataType>, or ReferenceColumn (which is not templated, as the
+ *             referenced columns might be of different column types)
+ *
+ *
+ * Example:
+ *
+ *   template <typename T>
+ *   void process_column(ValueColumn<T>& column);
+ *
+ *   template <typename T>
+ *   void process_column(DictionaryColumn<T>& column);
+ *
+ *   void process_column(ReferenceColumn& column);
+ *
+ *   resolve_column_type<T>(base_column, [&](auto& typed_column) {
+ *     process_column(typed_column);
+ *   });
+ */
+template <typename ColumnDataType, typename BaseColumnType, typename Functor>
+void resolve_column_type(BaseColumnType& column, const Functor& func) {
+  static_assert(std::is_same<std::remove_const_t<BaseColumnType>, BaseColumn>::value, "Expected a BaseColumn");
+
+  using ValueColumnPtr = detail::ConstOutIfConstIn<BaseColumnType, ValueColumn<ColumnDataType>>*;
+  using DictionaryColumnPtr = detail::ConstOutIfConstIn<BaseColumnType, DictionaryColumn<ColumnDataType>>*;
+  using ReferenceColumnPtr = detail::ConstOutIfConstIn<BaseColumnType, ReferenceColumn>*;
+
+  if (auto value_column = dynamic_cast<ValueColumnPtr>(&column)) {
+    func(*value_column);
+  } else if (auto dictionary_column = dynamic_cast<DictionaryColumnPtr>(&column)) {
+    func(*dictionary_column);
+  } else if (auto reference_column = dynamic_cast<ReferenceColumnPtr>(&column)) {
+    func(*reference_column);
+  } else {
+    Fail("Unrecognized column type encountered.");
+  }
+}
+
+/**
+ * Resolves a type string and a column at once by passing a hana::type object and the
+ * typed column on to a generic lambda
+ *
+ * @param type is a string representation of any of the supported column types
+ * @param column is the column that should be resolved
+ * @param func is a generic lambda or similar accepting a hana::type object and a reference to the typed column
+ *
+ *
+ * Example:
+ *
+ *   resolve_data_and_column_type(column_type, base_column, [&](auto type, auto& typed_column) {
+ *     using Type = typename decltype(type)::type;
+ *     process_column(typed_column);
+ *   });
+ */
+template <typename Functor, typename BaseColumnType>
+void resolve_data_and_column_type(const std::string& type, BaseColumnType& column, const Functor& func) {
+  resolve_data_type(type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    resolve_column_type<ColumnDataType>(column, [&](auto& typed_column) { func(type, typed_column); });
+  });
+}
+
+/**
+ * Resolves an attribute vector by casting it to its concrete type and passing it on to a generic lambda.
+ * Calling get() on the typed attribute vector does not require a virtual call.
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector_type(*dictionary_column.attribute_vector(), [&](const auto& attribute_vector) {
+ *     for (ChunkOffset offset = 0; offset < attribute_vector.size(); ++offset) {
+ *       process(attribute_vector.get(offset));
+ *     }
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector_type(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (auto fitted_8 = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*fitted_8);
+  } else if (auto fitted_16 = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*fitted_16);
+  } else if (auto fitted_32 = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*fitted_32);
+  } else if (auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed);
+  } else {
+    func(attribute_vector);
+  }
+}
+
 }  // namespace opossum
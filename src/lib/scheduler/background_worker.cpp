@@ -0,0 +1,61 @@
+#include "background_worker.hpp"
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace opossum {
+
+BackgroundWorker::~BackgroundWorker() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+    _functions.clear();
+  }
+  _scheduled_condition.notify_one();
+  if (_thread.joinable()) _thread.join();
+}
+
+void BackgroundWorker::schedule(std::function<void()> function) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _functions.push_back(std::move(function));
+    if (!_thread.joinable()) _thread = std::thread([this]() { _work(); });
+  }
+  _scheduled_condition.notify_one();
+}
+
+void BackgroundWorker::wait() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done_condition.wait(lock, [&]() { return _functions.empty() && !_running; });
+  if (_exception) std::rethrow_exception(std::exchange(_exception, nullptr));
+}
+
+void BackgroundWorker::_work() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _scheduled_condition.wait(lock, [&]() { return _shutdown || !_functions.empty(); });
+    if (_shutdown) return;
+
+    auto function = std::move(_functions.front());
+    _functions.pop_front();
+    _running = true;
+    lock.unlock();
+
+    std::exception_ptr exception;
+    try {
+      function();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    lock.lock();
+    _running = false;
+    if (exception && !_exception) _exception = exception;
+    if (_functions.empty()) _done_condition.notify_all();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A BackgroundWorker runs functions one after another on a single thread of its own, e.g., to compress the chunks of
+// a table without blocking inserts. Unlike the TaskScheduler, it does not take part in the execution of operators, so
+// the number of threads stays bounded no matter how many functions are scheduled.
+//
+// The thread is started along with the first function. Exceptions thrown by the functions are kept until the next
+// call to wait(). Functions that have not started when the worker is destroyed are dropped.
+class BackgroundWorker : private Noncopyable {
+ public:
+  BackgroundWorker() = default;
+  ~BackgroundWorker();
+
+  // queues a function for execution
+  void schedule(std::function<void()> function);
+
+  // blocks until all scheduled functions are done and rethrows the first exception thrown by any of them since the
+  // previous call
+  void wait();
+
+ protected:
+  // the loop run by the worker thread
+  void _work();
+
+  std::mutex _mutex;
+  // signals the worker thread that functions have been scheduled or that it is to stop
+  std::condition_variable _scheduled_condition;
+  // signals waiting threads that all functions are done
+  std::condition_variable _done_condition;
+  std::deque<std::function<void()>> _functions;
+  bool _running = false;
+  bool _shutdown = false;
+  std::exception_ptr _exception;
+  std::thread _thread;
+};
+
+}  // namespace opossum
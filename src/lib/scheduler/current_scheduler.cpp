@@ -0,0 +1,34 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "job_task.hpp"
+#include "task_scheduler.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TaskScheduler> CurrentScheduler::_instance;
+
+const std::shared_ptr<TaskScheduler>& CurrentScheduler::get() { return _instance; }
+
+void CurrentScheduler::set(const std::shared_ptr<TaskScheduler>& scheduler) { _instance = scheduler; }
+
+bool CurrentScheduler::is_set() { return static_cast<bool>(_instance); }
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks) {
+  if (!_instance) {
+    for (const auto& task : tasks) {
+      task->try_execute();
+      task->rethrow_exception();
+    }
+    return;
+  }
+
+  for (const auto& task : tasks) {
+    _instance->schedule(task);
+  }
+  _instance->wait_for_tasks(tasks);
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class JobTask;
+class TaskScheduler;
+
+// Holds the scheduler that operators use to run their jobs, e.g., one job per chunk.
+// Without a scheduler, jobs are executed one after another on the calling thread.
+// The scheduler must not be replaced while operators are running.
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<TaskScheduler>& get();
+  static void set(const std::shared_ptr<TaskScheduler>& scheduler);
+
+  static bool is_set();
+
+  // runs all tasks, in parallel if a scheduler is set, and rethrows the first exception thrown by any of them
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks);
+
+ private:
+  static std::shared_ptr<TaskScheduler> _instance;
+};
+
+}  // namespace opossum
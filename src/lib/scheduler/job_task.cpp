@@ -0,0 +1,34 @@
+#include "job_task.hpp"
+
+#include <exception>
+#include <functional>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JobTask::JobTask(std::function<void()> function) : _function{std::move(function)} {}
+
+bool JobTask::try_execute() {
+  if (_claimed.exchange(true)) return false;
+
+  try {
+    _function();
+  } catch (...) {
+    _exception = std::current_exception();
+  }
+
+  // the release store makes the function's results (and the exception) visible to threads that observe is_done()
+  _done.store(true, std::memory_order_release);
+  return true;
+}
+
+bool JobTask::is_done() const { return _done.load(std::memory_order_acquire); }
+
+void JobTask::rethrow_exception() const {
+  DebugAssert(is_done(), "Task has not finished yet");
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A JobTask wraps a function that is run exactly once, by whichever thread claims it first.
+// Exceptions thrown by the function are stored and rethrown by whoever waits for the task (see TaskScheduler).
+class JobTask : private Noncopyable {
+ public:
+  explicit JobTask(std::function<void()> function);
+
+  // runs the function unless another thread has claimed the task already. Returns whether the function was run.
+  bool try_execute();
+
+  // returns whether the function has finished
+  bool is_done() const;
+
+  // rethrows the exception thrown by the function, if any. Must only be called once the task is done.
+  void rethrow_exception() const;
+
+ protected:
+  std::function<void()> _function;
+  std::exception_ptr _exception;
+  std::atomic_bool _claimed{false};
+  std::atomic_bool _done{false};
+};
+
+}  // namespace opossum
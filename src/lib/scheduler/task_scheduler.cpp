@@ -0,0 +1,138 @@
+#include "task_scheduler.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// identifies the worker a thread belongs to, see TaskScheduler::_current_worker_id()
+thread_local const TaskScheduler* this_thread_scheduler = nullptr;
+thread_local size_t this_thread_worker_id = 0;
+
+}  // namespace
+
+TaskScheduler::TaskScheduler(const size_t worker_count) {
+  Assert(worker_count > 0, "A scheduler needs at least one worker");
+
+  for (size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+    _queues.push_back(std::make_unique<TaskQueue>());
+  }
+  for (size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back([this, worker_id]() { _work(worker_id); });
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(_idle_mutex);
+    _shutdown = true;
+  }
+  _idle_condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t TaskScheduler::worker_count() const { return _workers.size(); }
+
+void TaskScheduler::schedule(const std::shared_ptr<JobTask>& task) {
+  const auto worker_id = _current_worker_id();
+  const auto queue_id = worker_id ? *worker_id : _next_queue++ % _queues.size();
+
+  {
+    auto& queue = *_queues[queue_id];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+  }
+  ++_queued_task_count;
+
+  // taking the idle mutex ensures that no worker is between checking for tasks and going to sleep
+  { std::lock_guard<std::mutex> lock(_idle_mutex); }
+  _idle_condition.notify_one();
+}
+
+void TaskScheduler::wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks) {
+  const auto worker_id = _current_worker_id();
+
+  for (const auto& task : tasks) {
+    // run the task right away if no worker has picked it up yet, its queue entry is skipped later
+    if (task->try_execute()) continue;
+
+    // the task is running on another thread, help executing other tasks until it is done
+    while (!task->is_done()) {
+      if (auto other_task = _take_task(worker_id)) {
+        other_task->try_execute();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  for (const auto& task : tasks) {
+    task->rethrow_exception();
+  }
+}
+
+void TaskScheduler::_work(const size_t worker_id) {
+  this_thread_scheduler = this;
+  this_thread_worker_id = worker_id;
+
+  while (true) {
+    if (auto task = _take_task(worker_id)) {
+      task->try_execute();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_idle_mutex);
+    if (_shutdown && _queued_task_count == 0) return;
+    _idle_condition.wait(lock, [&]() { return _shutdown || _queued_task_count > 0; });
+  }
+}
+
+std::shared_ptr<JobTask> TaskScheduler::_take_task(const std::optional<size_t> worker_id) {
+  if (_queued_task_count == 0) return nullptr;
+
+  // workers prefer the most recent task of their own queue
+  if (worker_id) {
+    auto& queue = *_queues[*worker_id];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      auto task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --_queued_task_count;
+      return task;
+    }
+  }
+
+  // steal the oldest task of another queue, starting at a different queue for every worker to avoid contention
+  const auto first_queue_id = worker_id ? *worker_id + 1 : 0;
+  for (size_t offset = 0; offset < _queues.size(); ++offset) {
+    auto& queue = *_queues[(first_queue_id + offset) % _queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      auto task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --_queued_task_count;
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+std::optional<size_t> TaskScheduler::_current_worker_id() const {
+  if (this_thread_scheduler != this) return std::nullopt;
+  return this_thread_worker_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class JobTask;
+
+// The TaskScheduler runs JobTasks on a pool of worker threads.
+//
+// Every worker owns a queue of tasks. Tasks scheduled by a worker are pushed to its own queue, tasks scheduled by any
+// other thread are distributed round-robin. A worker takes the most recently scheduled task from its own queue
+// (which is likely still in its cache) and, once that is empty, steals the oldest task from the queue of another
+// worker. Threads that wait for tasks do not block, but help executing scheduled tasks in the meantime. This way,
+// tasks can schedule and wait for subtasks without exhausting the pool.
+class TaskScheduler : private Noncopyable {
+ public:
+  // creates a scheduler with the given number of worker threads
+  explicit TaskScheduler(const size_t worker_count = std::thread::hardware_concurrency());
+
+  // finishes all scheduled tasks and stops the workers
+  ~TaskScheduler();
+
+  size_t worker_count() const;
+
+  // queues a task for execution
+  void schedule(const std::shared_ptr<JobTask>& task);
+
+  // blocks until all given tasks are done and rethrows the first exception thrown by any of them
+  void wait_for_tasks(const std::vector<std::shared_ptr<JobTask>>& tasks);
+
+ protected:
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<JobTask>> tasks;
+  };
+
+  // the loop run by every worker thread
+  void _work(const size_t worker_id);
+
+  // takes a task from the given worker's queue or, if there is none, steals one from another worker
+  std::shared_ptr<JobTask> _take_task(const std::optional<size_t> worker_id);
+
+  // returns the id of the calling thread if it is a worker of this scheduler
+  std::optional<size_t> _current_worker_id() const;
+
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::vector<std::thread> _workers;
+  std::atomic<size_t> _next_queue{0};
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic_bool _shutdown{false};
+
+  // idle workers sleep until a task is scheduled
+  std::mutex _idle_mutex;
+  std::condition_variable _idle_condition;
+};
+
+}  // namespace opossum
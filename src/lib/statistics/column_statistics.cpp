@@ -0,0 +1,177 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "cast_predicate.hpp"
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/mix_hash.hpp"
+
+namespace opossum {
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const size_t sample_size, const size_t bucket_count)
+    : _sample_size{sample_size}, _bucket_count{bucket_count} {
+  Assert(sample_size > 0 && bucket_count > 0, "Sample and histogram must not be empty");
+  _sample.reserve(sample_size);
+}
+
+template <typename T>
+void ColumnStatistics<T>::update(const BaseColumn& column, const ChunkOffset begin, const ChunkOffset end) {
+  if (begin == end) return;
+
+  resolve_column_type<T>(column, [&](const auto& typed_column) {
+    // the column might still receive inserts beyond end, so it is not iterated any further
+    create_iterable_from_column<T>(typed_column, end).with_iterators([&](auto it, auto range_end) {
+      for (it += begin; it != range_end; ++it) {
+        if (it->is_null()) {
+          ++_null_count;
+          continue;
+        }
+        _add_value(it->value());
+      }
+    });
+  });
+
+  _histogram_outdated = true;
+}
+
+template <typename T>
+void ColumnStatistics<T>::_add_value(const typename ColumnIteratorValue<T>::ValueType& value) {
+  ++_value_count;
+  if (!_min || value < *_min) _min = T{value};
+  if (!_max || value > *_max) _max = T{value};
+  _distinct_values.add_hash(mix_hash(std::hash<typename ColumnIteratorValue<T>::ValueType>{}(value)));
+
+  // reservoir sampling: the n-th value replaces a random sample entry with a probability of sample_size / n
+  if (_sample.size() < _sample_size) {
+    _sample.emplace_back(value);
+    return;
+  }
+  const auto index = std::uniform_int_distribution<uint64_t>{0, _value_count - 1}(_random_engine);
+  if (index < _sample_size) _sample[index] = T{value};
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& value) const {
+  // comparisons with NULL are never true, just as other predicates that no value of type T satisfies
+  const auto predicate = cast_predicate<T>(scan_type, value);
+  if (!predicate) return 0.0;
+  return estimate_selectivity(predicate->scan_type, predicate->value);
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const T& value) const {
+  if (_value_count == 0) return 0.0;
+  _update_histogram();
+
+  // NULL values never satisfy a predicate
+  const auto non_null_fraction = 1.0 - null_fraction();
+
+  const auto fraction_equal = _fraction_equal(value);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return non_null_fraction * fraction_equal;
+    case ScanType::OpNotEquals:
+      return non_null_fraction * (1.0 - fraction_equal);
+    case ScanType::OpLessThan:
+      return non_null_fraction * _fraction_less(value);
+    case ScanType::OpLessThanEquals:
+      return non_null_fraction * std::min(1.0, _fraction_less(value) + fraction_equal);
+    case ScanType::OpGreaterThan:
+      return non_null_fraction * std::max(0.0, 1.0 - _fraction_less(value) - fraction_equal);
+    case ScanType::OpGreaterThanEquals:
+      return non_null_fraction * (1.0 - _fraction_less(value));
+  }
+  Fail("Unknown scan type");
+  return 0.0;
+}
+
+template <typename T>
+double ColumnStatistics<T>::distinct_count() const {
+  // the estimate cannot exceed the number of values
+  return std::min(_distinct_values.estimate(), static_cast<double>(_value_count));
+}
+
+template <typename T>
+double ColumnStatistics<T>::null_fraction() const {
+  const auto row_count = _value_count + _null_count;
+  return row_count == 0 ? 0.0 : static_cast<double>(_null_count) / static_cast<double>(row_count);
+}
+
+template <typename T>
+const std::optional<T>& ColumnStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const std::optional<T>& ColumnStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+void ColumnStatistics<T>::_update_histogram() const {
+  if (!_histogram_outdated) return;
+
+  _sorted_sample = _sample;
+  std::sort(_sorted_sample.begin(), _sorted_sample.end());
+
+  // every bucket holds the same number of sampled values
+  const auto bucket_count = std::min(_bucket_count, _sorted_sample.size());
+  _bucket_upper_bounds.clear();
+  for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    _bucket_upper_bounds.push_back(_sorted_sample[(bucket + 1) * _sorted_sample.size() / bucket_count - 1]);
+  }
+
+  _histogram_outdated = false;
+}
+
+template <typename T>
+double ColumnStatistics<T>::_fraction_less(const T& value) const {
+  if (value <= *_min) return 0.0;
+  if (value > *_max) return 1.0;
+
+  // all buckets before the one that contains value are smaller
+  const auto bucket = static_cast<size_t>(
+      std::lower_bound(_bucket_upper_bounds.cbegin(), _bucket_upper_bounds.cend(), value) -
+      _bucket_upper_bounds.cbegin());
+  const auto bucket_fraction = 1.0 / static_cast<double>(_bucket_upper_bounds.size());
+  if (bucket == _bucket_upper_bounds.size()) return 1.0;
+
+  // within the bucket, numerical values are assumed to be distributed uniformly, for strings we assume the middle
+  auto fraction_within_bucket = 0.5;
+  if constexpr (std::is_arithmetic<T>::value) {
+    const auto lower_bound = static_cast<double>(bucket == 0 ? *_min : _bucket_upper_bounds[bucket - 1]);
+    const auto upper_bound = static_cast<double>(_bucket_upper_bounds[bucket]);
+    if (upper_bound > lower_bound) {
+      fraction_within_bucket = (static_cast<double>(value) - lower_bound) / (upper_bound - lower_bound);
+    }
+  }
+
+  return (static_cast<double>(bucket) + fraction_within_bucket) * bucket_fraction;
+}
+
+template <typename T>
+double ColumnStatistics<T>::_fraction_equal(const T& value) const {
+  if (value < *_min || value > *_max) return 0.0;
+
+  // values that occur repeatedly in the sample are frequent, their share in the sample is a good estimate
+  const auto [first, last] = std::equal_range(_sorted_sample.cbegin(), _sorted_sample.cend(), value);
+  const auto sample_count = static_cast<size_t>(last - first);
+  if (sample_count >= 2) return static_cast<double>(sample_count) / static_cast<double>(_sorted_sample.size());
+
+  // all other values are assumed to be equally frequent
+  return 1.0 / std::max(1.0, distinct_count());
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "hyper_log_log.hpp"
+#include "storage/column_iterables.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// Statistics of all values of a table column, used to estimate the selectivity of predicates.
+// They are updated incrementally with the rows that are added to the table (see TableStatistics).
+class BaseColumnStatistics {
+ public:
+  virtual ~BaseColumnStatistics() = default;
+
+  // adds the values of the rows [begin, end) of a column
+  virtual void update(const BaseColumn& column, const ChunkOffset begin, const ChunkOffset end) = 0;
+
+  // returns the estimated fraction of rows that satisfy the predicate "column <scan_type> value"
+  virtual double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  // returns the estimated number of distinct values
+  virtual double distinct_count() const = 0;
+
+  // returns the fraction of NULL values
+  virtual double null_fraction() const = 0;
+};
+
+// Distinct values are counted with a HyperLogLog. Selectivities are estimated with an equi-depth histogram, which is
+// built from a fixed-size uniform sample of the values (reservoir sampling), so that updates are cheap and memory does
+// not grow with the table.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  explicit ColumnStatistics(const size_t sample_size = 4096, const size_t bucket_count = 64);
+
+  void update(const BaseColumn& column, const ChunkOffset begin, const ChunkOffset end) override;
+
+  double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& value) const override;
+  double estimate_selectivity(const ScanType scan_type, const T& value) const;
+
+  double distinct_count() const override;
+  double null_fraction() const override;
+
+  // returns the smallest and the largest value, if there are any
+  const std::optional<T>& min() const;
+  const std::optional<T>& max() const;
+
+ protected:
+  // strings are passed as string_views into the column and only copied when they are kept
+  void _add_value(const typename ColumnIteratorValue<T>::ValueType& value);
+
+  // rebuilds the histogram from the sample if values have been added since it was built
+  void _update_histogram() const;
+
+  // returns the estimated fraction of non-NULL values that are smaller than / equal to value
+  double _fraction_less(const T& value) const;
+  double _fraction_equal(const T& value) const;
+
+  const size_t _sample_size;
+  const size_t _bucket_count;
+
+  uint64_t _value_count = 0;
+  uint64_t _null_count = 0;
+  std::optional<T> _min;
+  std::optional<T> _max;
+  HyperLogLog _distinct_values;
+
+  std::vector<T> _sample;
+  std::mt19937_64 _random_engine;
+
+  // the histogram is built lazily from the sorted sample: bucket i holds the values up to _bucket_upper_bounds[i]
+  mutable bool _histogram_outdated = false;
+  mutable std::vector<T> _sorted_sample;
+  mutable std::vector<T> _bucket_upper_bounds;
+};
+
+}  // namespace opossum
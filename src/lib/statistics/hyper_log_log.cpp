@@ -0,0 +1,51 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision{precision}, _registers(size_t{1} << precision) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLog precision has to be between 4 and 18");
+}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto register_id = hash >> (64 - _precision);
+  // the remaining bits are shifted to the top, the set marker bit bounds the rank if all of them are zero
+  const auto remaining_bits = (hash << _precision) | (uint64_t{1} << (_precision - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+  _registers[register_id] = std::max(_registers[register_id], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(_precision == other._precision, "Only HyperLogLogs with the same precision can be merged");
+  for (size_t register_id = 0; register_id < _registers.size(); ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+
+  auto inverse_sum = 0.0;
+  auto empty_registers = 0u;
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -value);
+    if (value == 0) ++empty_registers;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // for small cardinalities, linear counting on the empty registers is more accurate
+  if (estimate <= 2.5 * register_count && empty_registers > 0) {
+    return register_count * std::log(register_count / empty_registers);
+  }
+  return estimate;
+}
+
+}  // namespace opossum
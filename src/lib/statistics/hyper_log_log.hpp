@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// HyperLogLog estimates the number of distinct values of a multiset in constant memory.
+// Every value is hashed, the first precision bits of the hash select a register, and the register keeps the maximum
+// number of leading zeros (plus one) seen in the remaining bits. With the default precision of 12, the 4096 registers
+// take 4 KB and the standard error is about 1.6%.
+class HyperLogLog {
+ public:
+  explicit HyperLogLog(const uint8_t precision = 12);
+
+  // adds a value given by its (well-distributed) 64 bit hash, see mix_hash
+  void add_hash(const uint64_t hash);
+
+  // adds all values of another HyperLogLog with the same precision
+  void merge(const HyperLogLog& other);
+
+  // returns the estimated number of distinct values added so far
+  double estimate() const;
+
+ protected:
+  const uint8_t _precision;
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const Table& table) {
+  for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+    _column_statistics.push_back(
+        make_shared_by_column_type<BaseColumnStatistics, ColumnStatistics>(table.column_type(column_id)));
+  }
+}
+
+void TableStatistics::update(const Table& table) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(_column_statistics.size() == table.col_count(), "Table schema has changed since the statistics were created");
+
+  const auto chunk_count = table.chunk_count();
+  _processed_chunk_sizes.resize(chunk_count, ChunkOffset{0});
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+
+    // only rows that have been completely written are visible, further rows are processed by the next update
+    const auto begin = _processed_chunk_sizes[chunk_id];
+    const auto end = static_cast<ChunkOffset>(chunk.size());
+    if (begin == end) continue;
+
+    for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+      _column_statistics[column_id]->update(*chunk.get_column(column_id), begin, end);
+    }
+
+    _row_count += end - begin;
+    _processed_chunk_sizes[chunk_id] = end;
+  }
+}
+
+uint16_t TableStatistics::column_count() const { return static_cast<uint16_t>(_column_statistics.size()); }
+
+uint64_t TableStatistics::row_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _row_count;
+}
+
+double TableStatistics::distinct_count(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _column_statistics.at(column_id)->distinct_count();
+}
+
+double TableStatistics::null_fraction(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _column_statistics.at(column_id)->null_fraction();
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& value) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _column_statistics.at(column_id)->estimate_selectivity(scan_type, value);
+}
+
+double TableStatistics::estimate_cardinality(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& value) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return static_cast<double>(_row_count) * _column_statistics.at(column_id)->estimate_selectivity(scan_type, value);
+}
+
+double TableStatistics::estimate_join_cardinality(const TableStatistics& left, const ColumnID left_column_id,
+                                                  const TableStatistics& right, const ColumnID right_column_id) {
+  // both sides are read one after another, so that joining a table with itself does not deadlock
+  const auto left_rows = static_cast<double>(left.row_count()) * (1.0 - left.null_fraction(left_column_id));
+  const auto left_distinct_count = left.distinct_count(left_column_id);
+  const auto right_rows = static_cast<double>(right.row_count()) * (1.0 - right.null_fraction(right_column_id));
+  const auto right_distinct_count = right.distinct_count(right_column_id);
+
+  const auto distinct_count = std::max(left_distinct_count, right_distinct_count);
+  if (distinct_count < 1.0) return 0.0;
+  return left_rows * right_rows / distinct_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Statistics of a table that are used to estimate the cardinality of predicates and joins, e.g., to order the
+// predicates of a query or to choose the build side of a join.
+// The statistics are updated incrementally: update() only processes the rows that have been added to the table since
+// the last update. All methods are thread-safe.
+class TableStatistics {
+ public:
+  // creates empty statistics for the columns of the given table, call update() to add its rows
+  explicit TableStatistics(const Table& table);
+
+  // adds all rows that have been appended to the table since the last update
+  void update(const Table& table);
+
+  // returns the number of columns the statistics were created for
+  uint16_t column_count() const;
+
+  // returns the number of rows covered by the statistics
+  uint64_t row_count() const;
+
+  // returns the estimated number of distinct values and the fraction of NULL values in a column
+  double distinct_count(const ColumnID column_id) const;
+  double null_fraction(const ColumnID column_id) const;
+
+  // returns the estimated fraction of rows that satisfy the predicate "column <scan_type> value"
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) const;
+
+  // returns the estimated number of rows that satisfy the predicate "column <scan_type> value"
+  double estimate_cardinality(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) const;
+
+  // returns the estimated number of rows of the equi-join of two tables. It assumes that the values of the column with
+  // fewer distinct values are contained in the other column ("containment of value sets").
+  static double estimate_join_cardinality(const TableStatistics& left, const ColumnID left_column_id,
+                                          const TableStatistics& right, const ColumnID right_column_id);
+
+ protected:
+  mutable std::mutex _mutex;
+  uint64_t _row_count = 0;
+  std::vector<std::shared_ptr<BaseColumnStatistics>> _column_statistics;
+
+  // the number of rows of each chunk that have already been processed
+  std::vector<ChunkOffset> _processed_chunk_sizes;
+};
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#include "attribute_vector_factory.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "fitted_attribute_vector.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const size_t unique_values_count, const size_t size,
+                                                           const PolymorphicAllocator<size_t>& alloc) {
+  // the largest value id that has to be stored
+  const auto max_value_id = unique_values_count > 0 ? unique_values_count - 1 : 0;
+
+  uint8_t bit_width = 1;
+  while (bit_width < 64 && (max_value_id >> bit_width) != 0) ++bit_width;
+
+  if (bit_width <= 4) {
+    return std::allocate_shared<BitPackedAttributeVector>(alloc, size, bit_width, alloc);
+  }
+  if (max_value_id <= std::numeric_limits<uint8_t>::max()) {
+    return std::allocate_shared<FittedAttributeVector<uint8_t>>(alloc, size, alloc);
+  }
+  if (max_value_id <= std::numeric_limits<uint16_t>::max()) {
+    return std::allocate_shared<FittedAttributeVector<uint16_t>>(alloc, size, alloc);
+  }
+  return std::allocate_shared<FittedAttributeVector<uint32_t>>(alloc, size, alloc);
+}
+
+}  // namespace opossum
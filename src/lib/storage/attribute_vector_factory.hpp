@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Creates the smallest attribute vector that can hold value ids in [0, unique_values_count).
+ *
+ * Very small dictionaries (up to 16 values, i.e., at most 4 bits per value id) get a BitPackedAttributeVector,
+ * all others a FittedAttributeVector of 1, 2, or 4 bytes per value id. Fitted vectors are preferred as soon as
+ * bit-packing saves less than half of the memory because their values can be read without shifting and masking.
+ * The attribute vector and its value ids are allocated by alloc.
+ */
+std::shared_ptr<BaseAttributeVector> make_attribute_vector(const size_t unique_values_count, const size_t size,
+                                                           const PolymorphicAllocator<size_t>& alloc = {});
+
+}  // namespace opossum
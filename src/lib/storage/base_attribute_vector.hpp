@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseAttributeVector is the abstract super class for all attribute vectors,
+// e.g., FittedAttributeVector, BitPackedAttributeVector.
+// An attribute vector stores the ValueIDs of a DictionaryColumn.
+class BaseAttributeVector : private Noncopyable {
+ public:
+  BaseAttributeVector() = default;
+  virtual ~BaseAttributeVector() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseAttributeVector(BaseAttributeVector&&) = default;
+  BaseAttributeVector& operator=(BaseAttributeVector&&) = default;
+
+  // returns the value id at a given position
+  virtual ValueID get(const size_t i) const = 0;
+
+  // sets the value id at a given position
+  virtual void set(const size_t i, const ValueID value_id) = 0;
+
+  // returns the number of values
+  virtual size_t size() const = 0;
+
+  // returns the number of bytes needed to hold one value id (rounded up for bit-packed vectors)
+  virtual AttributeVectorWidth width() const = 0;
+
+  // returns an estimate of the number of bytes that the attribute vector occupies
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+}  // namespace opossum
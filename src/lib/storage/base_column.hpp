@@ -26,7 +26,15 @@ class BaseColumn : private Noncopyable {
   // appends the value at the end of the column
   virtual void append(const AllTypeVariant& val) = 0;
 
+  // returns the value converted to the data type of the column, i.e., as append would store it. Throws if the value
+  // cannot be appended, e.g., because it is NULL and the column is not nullable, without changing the column
+  virtual AllTypeVariant cast_value(const AllTypeVariant& val) const = 0;
+
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns an estimate of the number of bytes that the column occupies, including the memory of its values (e.g.,
+  // the characters of strings) and memory that is reserved for values that have not been appended yet
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
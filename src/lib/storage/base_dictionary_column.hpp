@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// BaseDictionaryColumn is the untyped interface of all DictionaryColumns. It allows, e.g., indices to work on the
+// ValueIDs of a column without knowing the type of its values.
+//
+// NULLs are represented by the ValueID that follows the last dictionary entry (see null_value_id), so that they sort
+// behind all values and the dictionary itself only holds actual values.
+class BaseDictionaryColumn : public BaseColumn {
+ public:
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // return the number of unique_values (dictionary entries)
+  virtual size_t unique_values_count() const = 0;
+
+  // returns an underlying data structure
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+
+  // returns whether the attribute vector may contain null_value_id()
+  virtual bool is_nullable() const = 0;
+
+  // returns the ValueID that represents NULL, i.e., the number of dictionary entries
+  ValueID null_value_id() const { return ValueID{static_cast<ValueID::base_type>(unique_values_count())}; }
+};
+
+}  // namespace opossum
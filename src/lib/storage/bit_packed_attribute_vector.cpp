@@ -0,0 +1,64 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   const PolymorphicAllocator<uint64_t>& alloc)
+    : _size{size}, _bit_width{bit_width}, _mask{(uint64_t{1} << bit_width) - 1}, _words(alloc) {
+  DebugAssert(bit_width > 0 && bit_width <= 32, "Bit width must be between 1 and 32");
+  // one additional word allows get() to always read two words without bounds checks
+  _words.resize((size * bit_width + 63) / 64 + 1);
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   pmr_vector<uint64_t>&& words)
+    : _size{size}, _bit_width{bit_width}, _mask{(uint64_t{1} << bit_width) - 1}, _words{std::move(words)} {
+  Assert(bit_width > 0 && bit_width <= 32, "Bit width must be between 1 and 32");
+  Assert(_words.size() == (size * bit_width + 63) / 64 + 1, "Number of words does not match size and bit width");
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  const auto bit_offset = i * _bit_width;
+  const auto word = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+
+  auto value = _words[word] >> shift;
+  // shifting a 64-bit word by 64 is undefined, so the upper part is only read when the value spans two words
+  if (shift + _bit_width > 64) value |= _words[word + 1] << (64 - shift);
+  return ValueID{static_cast<ValueID::base_type>(value & _mask)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "Position out of range");
+  DebugAssert(static_cast<uint64_t>(value_id) <= _mask, "Value id does not fit into attribute vector");
+
+  const auto bit_offset = i * _bit_width;
+  const auto word = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+  const auto value = static_cast<uint64_t>(value_id);
+
+  _words[word] = (_words[word] & ~(_mask << shift)) | (value << shift);
+  if (shift + _bit_width > 64) {
+    const auto written_bits = 64 - shift;
+    _words[word + 1] = (_words[word + 1] & ~(_mask >> written_bits)) | (value >> written_bits);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return sizeof(*this) + _words.capacity() * sizeof(uint64_t);
+}
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+const pmr_vector<uint64_t>& BitPackedAttributeVector::words() const { return _words; }
+
+}  // namespace opossum
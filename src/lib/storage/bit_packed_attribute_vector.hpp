@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id in exactly bit_width bits.
+// Values may span two consecutive 64-bit words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                           const PolymorphicAllocator<uint64_t>& alloc = {});
+
+  // creates an attribute vector that takes over the given words (see words()) without copying them
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width, pmr_vector<uint64_t>&& words);
+
+  // final allows calls through a BitPackedAttributeVector reference to skip the virtual dispatch
+  ValueID get(const size_t i) const final;
+
+  void set(const size_t i, const ValueID value_id) override;
+
+  size_t size() const override;
+
+  AttributeVectorWidth width() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // returns the words that hold the packed value ids, e.g., to write them to disk
+  const pmr_vector<uint64_t>& words() const;
+
+ private:
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+  pmr_vector<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -1,42 +1,128 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "chunk_statistics.hpp"
+#include "index/base_index.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_column(std::shared_ptr<BaseColumn> column) { _columns.push_back(column); }
+Chunk::Chunk(const PolymorphicAllocator<Chunk>& alloc) : _alloc{alloc} {}
+
+const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
+
+void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
+  _columns.push_back(column);
+  if (_columns.size() == 1) publish_appended_rows();
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(!is_immutable(), "Immutable chunks cannot be appended to");
   DebugAssert(values.size() == _columns.size(), "Number of values does not match number of columns");
 
+  // all values are converted before the first one is written, so that a value that cannot be appended to its column
+  // leaves the chunk unchanged
+  std::vector<AllTypeVariant> cast_values;
+  cast_values.reserve(values.size());
   auto val_it = values.begin();
   auto col_it = _columns.begin();
   while (val_it != values.end() && col_it != _columns.end()) {
-    col_it->get()->append(*val_it);
+    cast_values.push_back(col_it->get()->cast_value(*val_it));
     ++val_it;
     ++col_it;
   }
+
+  for (ColumnID column_id{0}; column_id < cast_values.size(); ++column_id) {
+    _columns[column_id]->append(cast_values[column_id]);
+  }
+  publish_appended_rows();
 }
 
-std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return _columns.at(column_id); }
+void Chunk::publish_appended_rows() {
+  if (_columns.empty()) return;
+  // only rows that have been written to all columns are published
+  auto size = get_column(ColumnID{0})->size();
+  for (ColumnID column_id{1}; column_id < _columns.size(); ++column_id) {
+    size = std::min(size, get_column(column_id)->size());
+  }
+  // release semantics make sure that readers who see the new size also see the written values
+  _size.store(static_cast<uint32_t>(size), std::memory_order_release);
+}
 
-uint16_t Chunk::col_count() const { return static_cast<uint16_t>(_columns.size()); }
+void Chunk::mark_immutable() { _immutable.store(true, std::memory_order_release); }
 
-uint32_t Chunk::size() const {
-  if (_columns.empty()) {
-    return 0;
+bool Chunk::is_immutable() const { return _immutable.load(std::memory_order_acquire); }
+
+std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
+  return std::atomic_load(&_columns.at(column_id));
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _columns.capacity() * sizeof(std::shared_ptr<BaseColumn>);
+  for (ColumnID column_id{0}; column_id < _columns.size(); ++column_id) {
+    bytes += get_column(column_id)->estimate_memory_usage();
   }
-  return static_cast<uint32_t>(_columns.at(0)->size());
+  return bytes;
+}
+
+void Chunk::replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column) {
+  DebugAssert(column->size() == size(), "Replacing column has to have the same size");
+  std::atomic_store(&_columns.at(column_id), column);
+}
+
+std::shared_ptr<const ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
+
+void Chunk::set_statistics(std::shared_ptr<const ChunkStatistics> statistics) {
+  std::atomic_store(&_statistics, statistics);
 }
 
+std::vector<std::shared_ptr<const BaseIndex>> Chunk::get_indices(const std::vector<ColumnID>& column_ids) const {
+  const auto columns = _get_columns_for_ids(column_ids);
+
+  std::shared_lock<std::shared_mutex> lock(_indices_mutex);
+  std::vector<std::shared_ptr<const BaseIndex>> indices;
+  for (const auto& index : _indices) {
+    if (index->is_index_for(columns)) indices.push_back(index);
+  }
+  return indices;
+}
+
+std::shared_ptr<const BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
+                                                  const std::vector<ColumnID>& column_ids) const {
+  for (const auto& index : get_indices(column_ids)) {
+    if (index->type() == index_type) return index;
+  }
+  return nullptr;
+}
+
+std::vector<std::shared_ptr<const BaseColumn>> Chunk::_get_columns_for_ids(
+    const std::vector<ColumnID>& column_ids) const {
+  std::vector<std::shared_ptr<const BaseColumn>> columns;
+  columns.reserve(column_ids.size());
+  for (const auto& column_id : column_ids) {
+    columns.push_back(get_column(column_id));
+  }
+  return columns;
+}
+
+void Chunk::_add_index(std::shared_ptr<const BaseIndex> index) {
+  std::unique_lock<std::shared_mutex> lock(_indices_mutex);
+  _indices.push_back(index);
+}
+
+uint16_t Chunk::col_count() const { return static_cast<uint16_t>(_columns.size()); }
+
+uint32_t Chunk::size() const { return _size.load(std::memory_order_acquire); }
+
 }  // namespace opossum
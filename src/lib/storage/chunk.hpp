@@ -15,19 +15,24 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+class ChunkStatistics;
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
 //
 // Find more information about this in our wiki: https://github.com/hyrise/zweirise/wiki/chunk-concept
+//
+// Rows become visible to readers (i.e., are counted by size()) only after they have been
+// written to all columns. Writers have to be synchronized externally, e.g., by Table's append mutex.
+//
+// The chunk carries the allocator with which its columns are created (see Table). It is not used for the chunk's own
+// bookkeeping, which is small compared to the columns.
 class Chunk : private Noncopyable {
  public:
-  Chunk() = default;
+  explicit Chunk(const PolymorphicAllocator<Chunk>& alloc = {});
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Chunk(Chunk&&) = default;
-  Chunk& operator=(Chunk&&) = default;
+  // returns the allocator for the data of the chunk's columns
+  const PolymorphicAllocator<Chunk>& get_allocator() const;
 
   // adds a column to the "right" of the chunk
   void add_column(std::shared_ptr<BaseColumn> column);
@@ -35,18 +40,70 @@ class Chunk : private Noncopyable {
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t col_count() const;
 
-  // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
+  // returns the number of rows that are visible to readers (cannot exceed ChunkOffset (uint32_t))
   uint32_t size() const;
 
   // adds a new row, given as a list of values, to the chunk
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // makes rows visible that have been written to the columns directly, e.g., by Table::append_columns
+  void publish_appended_rows();
+
+  // marks the chunk as complete, i.e., it does not receive any further inserts. Only then, its statistics stay valid
+  // and its columns can be encoded (see Table). A chunk cannot become mutable again
+  void mark_immutable();
+
+  // returns whether the chunk has been marked as complete
+  bool is_immutable() const;
+
   // Returns the column at a given position
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // returns an estimate of the number of bytes that the chunk and its columns occupy (see
+  // BaseColumn::estimate_memory_usage). Indices and statistics are not included. Like other reads of the columns, it
+  // must not run concurrently to writers.
+  size_t estimate_memory_usage() const;
+
+  // atomically replaces the column at a given position, e.g., by an encoded version of the same data.
+  // readers that already hold the previous column keep it alive until they are done with it.
+  void replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column);
+
+  // returns the statistics of the chunk's columns (e.g., min and max), or nullptr if there are none.
+  // statistics are only available for chunks that do not receive inserts anymore (see Table).
+  std::shared_ptr<const ChunkStatistics> statistics() const;
+
+  // atomically sets the statistics, so that they can be published while the chunk is read
+  void set_statistics(std::shared_ptr<const ChunkStatistics> statistics);
+
+  // creates an index of the given type (e.g., GroupKeyIndex) on the given columns and adds it to the chunk.
+  // indices can only be created on columns that do not change anymore, i.e., dictionary columns
+  template <typename IndexType>
+  std::shared_ptr<IndexType> create_index(const std::vector<ColumnID>& column_ids) {
+    auto index = std::make_shared<IndexType>(_get_columns_for_ids(column_ids));
+    _add_index(index);
+    return index;
+  }
+
+  // returns all indices that cover exactly the given columns, in this order
+  std::vector<std::shared_ptr<const BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
+
+  // returns the index of the given type that covers exactly the given columns, or nullptr if there is none
+  std::shared_ptr<const BaseIndex> get_index(const ColumnIndexType index_type,
+                                             const std::vector<ColumnID>& column_ids) const;
+
  private:
+  std::vector<std::shared_ptr<const BaseColumn>> _get_columns_for_ids(const std::vector<ColumnID>& column_ids) const;
+  void _add_index(std::shared_ptr<const BaseIndex> index);
+
+  PolymorphicAllocator<Chunk> _alloc;
   std::vector<std::shared_ptr<BaseColumn>> _columns;
+  std::shared_ptr<const ChunkStatistics> _statistics;
+  // indices may be added while the chunk is read
+  mutable std::shared_mutex _indices_mutex;
+  std::vector<std::shared_ptr<const BaseIndex>> _indices;
+  std::atomic<uint32_t> _size{0};
+  std::atomic<bool> _immutable{false};
 };
 
 }  // namespace opossum
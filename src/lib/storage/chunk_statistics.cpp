@@ -0,0 +1,171 @@
+#include "chunk_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cast_predicate.hpp"
+#include "chunk.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/mix_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Estimates the number of distinct values by linear counting: every value sets one bit of a bitmap that is about as
+// large as the number of values, and the number of distinct values is derived from the fraction of unset bits.
+// NULLs (if null_values is given) are not counted.
+template <typename Values>
+uint32_t estimate_distinct_count(const Values& values, const size_t row_count, const NullBitmap* null_values,
+                                 const size_t value_count) {
+  if (value_count == 0) return 0;
+
+  auto bitmap_size = size_t{64};
+  while (bitmap_size < value_count) bitmap_size <<= 1;
+  std::vector<bool> bitmap(bitmap_size);
+
+  const auto hash = std::hash<typename Values::value_type>{};
+  for_each_non_null(null_values, row_count, [&](const size_t index) {
+    bitmap[mix_hash(hash(values[index])) & (bitmap_size - 1)] = true;
+  });
+
+  const auto unset_bits = static_cast<double>(std::count(bitmap.cbegin(), bitmap.cend(), false));
+  if (unset_bits == 0) return static_cast<uint32_t>(value_count);
+
+  const auto estimate = -static_cast<double>(bitmap_size) * std::log(unset_bits / static_cast<double>(bitmap_size));
+  return static_cast<uint32_t>(std::min(std::round(estimate), static_cast<double>(value_count)));
+}
+
+}  // namespace
+
+template <typename T>
+ChunkColumnStatistics<T>::ChunkColumnStatistics(T min, T max, const uint32_t null_count,
+                                                const uint32_t distinct_count)
+    : BaseChunkColumnStatistics{null_count, distinct_count}, _min{std::move(min)}, _max{std::move(max)} {}
+
+template <typename T>
+const T& ChunkColumnStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& ChunkColumnStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+bool ChunkColumnStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& value) const {
+  // the value is not truncated to T, e.g., "< 2.5" must not prune a chunk whose minimum is 2
+  const auto predicate = cast_predicate<T>(scan_type, value);
+  return !predicate || can_prune(predicate->scan_type, predicate->value);
+}
+
+template <typename T>
+bool ChunkColumnStatistics<T>::can_prune(const ScanType scan_type, const T& value) const {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < _min || value > _max;
+    case ScanType::OpNotEquals:
+      return _min == value && _max == value;
+    case ScanType::OpLessThan:
+      return value <= _min;
+    case ScanType::OpLessThanEquals:
+      return value < _min;
+    case ScanType::OpGreaterThan:
+      return value >= _max;
+    case ScanType::OpGreaterThanEquals:
+      return value > _max;
+  }
+  Fail("Unknown scan type");
+  return false;
+}
+
+ChunkStatistics::ChunkStatistics(std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics)
+    : _column_statistics{std::move(column_statistics)} {}
+
+const std::shared_ptr<const BaseChunkColumnStatistics>& ChunkStatistics::column_statistics(
+    const ColumnID column_id) const {
+  return _column_statistics.at(column_id);
+}
+
+bool ChunkStatistics::can_prune(const ColumnID column_id, const ScanType scan_type,
+                                const AllTypeVariant& value) const {
+  // comparisons with NULL are never true
+  if (variant_is_null(value)) return true;
+  const auto& column_statistics = _column_statistics.at(column_id);
+  return column_statistics && column_statistics->can_prune(scan_type, value);
+}
+
+std::shared_ptr<ChunkStatistics> compute_chunk_statistics(const Chunk& chunk,
+                                                          const std::vector<std::string>& column_types) {
+  const auto chunk_size = chunk.size();
+  std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics(chunk.col_count());
+  if (chunk_size == 0) return std::make_shared<ChunkStatistics>(std::move(column_statistics));
+
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    const auto column = chunk.get_column(column_id);
+
+    resolve_data_and_column_type(column_types.at(column_id), *column, [&](auto type, const auto& typed_column) {
+      using ColumnDataType = typename decltype(type)::type;
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (std::is_same<ColumnType, ValueColumn<ColumnDataType>>::value) {
+        const auto& values = typed_column.values();
+        if (!typed_column.is_nullable()) {
+          const auto [min, max] = std::minmax_element(values.cbegin(), values.cbegin() + chunk_size);
+          column_statistics[column_id] = std::make_shared<ChunkColumnStatistics<ColumnDataType>>(
+              ColumnDataType{*min}, ColumnDataType{*max}, 0u,
+              estimate_distinct_count(values, chunk_size, nullptr, chunk_size));
+          return;
+        }
+
+        const auto& null_values = typed_column.null_values();
+        const auto null_count = static_cast<uint32_t>(null_values.null_count(chunk_size));
+        // columns that consist of NULLs only have neither a minimum nor a maximum
+        if (null_count == chunk_size) return;
+
+        auto first_value = size_t{0};
+        while (null_values.is_null(first_value)) ++first_value;
+        auto min = values[first_value];
+        auto max = min;
+        for_each_non_null(null_values, chunk_size, [&](const size_t index) {
+          if (values[index] < min) min = values[index];
+          if (values[index] > max) max = values[index];
+        });
+        column_statistics[column_id] = std::make_shared<ChunkColumnStatistics<ColumnDataType>>(
+            ColumnDataType{min}, ColumnDataType{max}, null_count,
+            estimate_distinct_count(values, chunk_size, &null_values, chunk_size - null_count));
+      } else if constexpr (std::is_same<ColumnType, DictionaryColumn<ColumnDataType>>::value) {
+        const auto& dictionary = *typed_column.dictionary();
+        if (dictionary.empty()) return;
+
+        auto null_count = uint32_t{0};
+        if (typed_column.is_nullable()) {
+          const auto null_value_id = typed_column.null_value_id();
+          resolve_attribute_vector_type(*typed_column.attribute_vector(), [&](const auto& attribute_vector) {
+            for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+              null_count += attribute_vector.get(chunk_offset) == null_value_id;
+            }
+          });
+        }
+        column_statistics[column_id] = std::make_shared<ChunkColumnStatistics<ColumnDataType>>(
+            dictionary.front(), dictionary.back(), null_count, static_cast<uint32_t>(dictionary.size()));
+      }
+      // reference columns do not get statistics, as their values belong to another table
+    });
+  }
+
+  return std::make_shared<ChunkStatistics>(std::move(column_statistics));
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ChunkColumnStatistics);
+
+}  // namespace opossum
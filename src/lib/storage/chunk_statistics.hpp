@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Statistics of a single column of a chunk that does not receive inserts anymore, i.e., a zone map.
+// They allow operators to skip chunks that cannot contain matching rows.
+class BaseChunkColumnStatistics {
+ public:
+  BaseChunkColumnStatistics(const uint32_t null_count, const uint32_t distinct_count)
+      : _null_count{null_count}, _distinct_count{distinct_count} {}
+  virtual ~BaseChunkColumnStatistics() = default;
+
+  // returns whether no row of the chunk can satisfy the predicate "column <scan_type> value"
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& value) const = 0;
+
+  // returns the number of NULL values in the column
+  uint32_t null_count() const { return _null_count; }
+
+  // returns the (possibly estimated) number of distinct values in the column
+  uint32_t distinct_count() const { return _distinct_count; }
+
+ protected:
+  const uint32_t _null_count;
+  const uint32_t _distinct_count;
+};
+
+template <typename T>
+class ChunkColumnStatistics : public BaseChunkColumnStatistics {
+ public:
+  ChunkColumnStatistics(T min, T max, const uint32_t null_count, const uint32_t distinct_count);
+
+  const T& min() const;
+  const T& max() const;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& value) const override;
+  bool can_prune(const ScanType scan_type, const T& value) const;
+
+ protected:
+  const T _min;
+  const T _max;
+};
+
+// Statistics of all columns of a chunk
+class ChunkStatistics : private Noncopyable {
+ public:
+  // column statistics may be nullptr for columns that have no statistics
+  explicit ChunkStatistics(std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics);
+
+  // returns the statistics of the given column, or nullptr if there are none
+  const std::shared_ptr<const BaseChunkColumnStatistics>& column_statistics(const ColumnID column_id) const;
+
+  // returns whether no row of the chunk can satisfy the predicate "column <scan_type> value"
+  bool can_prune(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) const;
+
+ protected:
+  const std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> _column_statistics;
+};
+
+// Computes the statistics of all columns of a chunk. For value columns, the number of distinct values is estimated
+// (linear counting), for dictionary columns it is exact and min and max are read from the dictionary.
+// The chunk must not receive any further inserts, as the statistics would not be updated.
+std::shared_ptr<ChunkStatistics> compute_chunk_statistics(const Chunk& chunk,
+                                                          const std::vector<std::string>& column_types);
+
+}  // namespace opossum
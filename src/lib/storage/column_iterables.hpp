@@ -0,0 +1,85 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The value an iterator of a column iterable points to.
+ * Besides the value itself, it contains whether the value is NULL and its position within the chunk.
+ * Strings are returned as std::string_views into the column (or its dictionary), so that iterating does not copy them.
+ */
+template <typename T>
+class ColumnIteratorValue {
+ public:
+  using ValueType = std::conditional_t<std::is_same<T, std::string>::value, std::string_view, T>;
+
+  ColumnIteratorValue(ValueType value, const bool null_value, const ChunkOffset chunk_offset)
+      : _value{std::move(value)}, _null_value{null_value}, _chunk_offset{chunk_offset} {}
+
+  const ValueType& value() const { return _value; }
+  bool is_null() const { return _null_value; }
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ private:
+  ValueType _value;
+  bool _null_value;
+  ChunkOffset _chunk_offset;
+};
+
+/**
+ * Base class of all column iterators. Derived iterators only have to implement
+ * dereference(), equal(), increment(), decrement(), advance(), and distance_to().
+ * Values are returned by value so that encoded columns can decode them on the fly.
+ */
+template <typename Derived, typename Value>
+using BaseColumnIterator = boost::iterator_facade<Derived, Value, boost::random_access_traversal_tag, Value>;
+
+/**
+ * Column iterables provide a unified interface to iterate over the values of any column type.
+ *
+ * An iterable is created from a typed column (see create_iterable_from_column.hpp) and passes
+ * a pair of begin and end iterators to a generic lambda. Because the concrete iterator type is
+ * known inside the lambda, the loop is fully inlined and does not require any virtual calls.
+ *
+ * Example:
+ *
+ *   auto iterable = create_iterable_from_column(typed_column);
+ *   iterable.with_iterators([&](auto it, auto end) {
+ *     for (; it != end; ++it) {
+ *       if (it->is_null()) continue;
+ *       process(it->value(), it->chunk_offset());
+ *     }
+ *   });
+ */
+template <typename Derived>
+class ColumnIterable {
+ public:
+  template <typename Functor>
+  void with_iterators(const Functor& functor) const {
+    _self()._on_with_iterators(functor);
+  }
+
+  // calls the functor for every ColumnIteratorValue of the column
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    with_iterators([&functor](auto it, auto end) {
+      for (; it != end; ++it) {
+        functor(*it);
+      }
+    });
+  }
+
+ private:
+  const Derived& _self() const { return static_cast<const Derived&>(*this); }
+};
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "dictionary_column_iterable.hpp"
+#include "reference_column_iterable.hpp"
+#include "value_column_iterable.hpp"
+
+namespace opossum {
+
+/**
+ * Creates the matching column iterable for a typed column.
+ * As reference columns are not templated, the data type has to be passed explicitly when the column might be a
+ * ReferenceColumn. Use together with resolve_column_type (see resolve_type.hpp) to iterate over any BaseColumn:
+ *
+ *   resolve_column_type<T>(base_column, [&](const auto& typed_column) {
+ *     auto iterable = create_iterable_from_column<T>(typed_column);
+ *     iterable.for_each([&](const auto& column_value) { ... });
+ *   });
+ *
+ * Columns of a chunk that might still receive inserts have to be iterated up to the size that the chunk has published
+ * (see Chunk::size) only, so that neither rows that are partially written nor the column's own size are read while
+ * writers append to it:
+ *
+ *   const auto chunk_size = chunk.size();
+ *   auto iterable = create_iterable_from_column<T>(typed_column, chunk_size);
+ */
+template <typename T>
+auto create_iterable_from_column(const ValueColumn<T>& column) {
+  return ValueColumnIterable<T>{column};
+}
+
+template <typename T>
+auto create_iterable_from_column(const ValueColumn<T>& column, const ChunkOffset size) {
+  return ValueColumnIterable<T>{column, size};
+}
+
+template <typename T>
+auto create_iterable_from_column(const DictionaryColumn<T>& column) {
+  return DictionaryColumnIterable<T>{column};
+}
+
+template <typename T>
+auto create_iterable_from_column(const DictionaryColumn<T>& column, const ChunkOffset size) {
+  return DictionaryColumnIterable<T>{column, size};
+}
+
+template <typename T>
+auto create_iterable_from_column(const ReferenceColumn& column) {
+  return ReferenceColumnIterable<T>{column};
+}
+
+template <typename T>
+auto create_iterable_from_column(const ReferenceColumn& column, const ChunkOffset size) {
+  return ReferenceColumnIterable<T>{column, size};
+}
+
+}  // namespace opossum
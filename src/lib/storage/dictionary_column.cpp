@@ -0,0 +1,176 @@
+#include "dictionary_column.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "attribute_vector_factory.hpp"
+#include "base_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column,
+                                      const PolymorphicAllocator<T>& alloc)
+    : _dictionary{std::allocate_shared<pmr_vector<T>>(alloc)} {
+  const auto column_size = base_column->size();
+
+  std::vector<T> values;
+  std::vector<bool> null_values;
+  if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(base_column)) {
+    // typed access avoids a virtual call and an AllTypeVariant per value
+    values.reserve(column_size);
+    for (const auto value : value_column->values()) values.emplace_back(value);
+    _nullable = value_column->is_nullable();
+    if (_nullable) {
+      null_values.resize(column_size);
+      for (size_t offset = 0; offset < column_size; ++offset) {
+        null_values[offset] = value_column->null_values().is_null(offset);
+      }
+    }
+  } else {
+    values.reserve(column_size);
+    null_values.reserve(column_size);
+    for (size_t offset = 0; offset < column_size; ++offset) {
+      const auto value = (*base_column)[offset];
+      null_values.push_back(variant_is_null(value));
+      values.push_back(null_values.back() ? T{} : type_cast<T>(value));
+    }
+    _nullable = std::find(null_values.cbegin(), null_values.cend(), true) != null_values.cend();
+  }
+
+  // the dictionary holds every distinct value exactly once, in sorted order
+  _dictionary->reserve(column_size);
+  for (size_t offset = 0; offset < column_size; ++offset) {
+    if (!_nullable || !null_values[offset]) _dictionary->push_back(values[offset]);
+  }
+  std::sort(_dictionary->begin(), _dictionary->end());
+  _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
+  _dictionary->shrink_to_fit();
+
+  // nullable columns need one more ValueID for NULL
+  _attribute_vector = make_attribute_vector(_dictionary->size() + (_nullable ? 1 : 0), column_size, alloc);
+  for (size_t offset = 0; offset < column_size; ++offset) {
+    if (_nullable && null_values[offset]) {
+      _attribute_vector->set(offset, null_value_id());
+      continue;
+    }
+    const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), values[offset]);
+    _attribute_vector->set(offset,
+                           ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), it))});
+  }
+}
+
+template <typename T>
+DictionaryColumn<T>::DictionaryColumn(std::shared_ptr<pmr_vector<T>> dictionary,
+                                      std::shared_ptr<BaseAttributeVector> attribute_vector, const bool nullable)
+    : _dictionary{std::move(dictionary)}, _attribute_vector{std::move(attribute_vector)}, _nullable{nullable} {}
+
+template <typename T>
+const AllTypeVariant DictionaryColumn<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  if (is_null(i)) return NULL_VALUE;
+  return get(i);
+}
+
+template <typename T>
+const T DictionaryColumn<T>::get(const size_t i) const {
+  DebugAssert(i < _attribute_vector->size(), "Position out of range");
+  DebugAssert(!is_null(i), "Value is NULL");
+  return _dictionary->at(_attribute_vector->get(i));
+}
+
+template <typename T>
+bool DictionaryColumn<T>::is_null(const size_t i) const {
+  return _nullable && _attribute_vector->get(i) == null_value_id();
+}
+
+template <typename T>
+void DictionaryColumn<T>::append(const AllTypeVariant&) {
+  Fail("Dictionary columns are immutable");
+}
+
+template <typename T>
+AllTypeVariant DictionaryColumn<T>::cast_value(const AllTypeVariant&) const {
+  Fail("Dictionary columns are immutable");
+  return NULL_VALUE;
+}
+
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> DictionaryColumn<T>::dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> DictionaryColumn<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+bool DictionaryColumn<T>::is_nullable() const {
+  return _nullable;
+}
+
+template <typename T>
+const T& DictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
+  return _dictionary->at(value_id);
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::lower_bound(T value) const {
+  const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::lower_bound(const AllTypeVariant& value) const {
+  return lower_bound(type_cast<T>(value));
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::upper_bound(T value) const {
+  const auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (it == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->cbegin(), it))};
+}
+
+template <typename T>
+ValueID DictionaryColumn<T>::upper_bound(const AllTypeVariant& value) const {
+  return upper_bound(type_cast<T>(value));
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::unique_values_count() const {
+  return _dictionary->size();
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::size() const {
+  return _attribute_vector->size();
+}
+
+template <typename T>
+size_t DictionaryColumn<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + sizeof(*_dictionary) + _dictionary->capacity() * sizeof(T);
+  if constexpr (std::is_same<T, std::string>::value) {
+    // strings that do not fit into the string object itself allocate their characters (and a terminator) separately
+    const auto local_capacity = std::string{}.capacity();
+    for (const auto& value : *_dictionary) {
+      if (value.capacity() > local_capacity) bytes += value.capacity() + 1;
+    }
+  }
+  return bytes + _attribute_vector->estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(DictionaryColumn);
+
+}  // namespace opossum
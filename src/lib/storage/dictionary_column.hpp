@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_dictionary_column.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// DictionaryColumn is a specific column type that stores every distinct value once in a sorted dictionary
+// and represents each row by the ValueID of its value, i.e., its position in the dictionary
+template <typename T>
+class DictionaryColumn : public BaseDictionaryColumn {
+ public:
+  /**
+   * Creates a Dictionary column from a given value column. Dictionary and attribute vector are allocated by alloc.
+   * The strings of a string dictionary allocate their characters on their own unless they are short.
+   */
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column, const PolymorphicAllocator<T>& alloc = {});
+
+  /**
+   * Creates a Dictionary column from an already encoded dictionary and attribute vector, e.g., when loading a table.
+   * If the column is nullable, the attribute vector may contain the null value id (see BaseDictionaryColumn).
+   */
+  DictionaryColumn(std::shared_ptr<pmr_vector<T>> dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector,
+                   const bool nullable = false);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position, which must not be NULL.
+  const T get(const size_t i) const;
+
+  // returns whether the value at a certain position is NULL
+  bool is_null(const size_t i) const;
+
+  // dictionary columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // dictionary columns are immutable, so no value can be appended
+  AllTypeVariant cast_value(const AllTypeVariant&) const override;
+
+  // returns an underlying dictionary
+  std::shared_ptr<const pmr_vector<T>> dictionary() const;
+
+  // returns an underlying data structure
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override;
+
+  bool is_nullable() const override;
+
+  // return the value represented by a given ValueID
+  const T& value_by_value_id(ValueID value_id) const;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  ValueID lower_bound(T value) const;
+
+  // same as lower_bound(T), but accepts an AllTypeVariant
+  ValueID lower_bound(const AllTypeVariant& value) const override;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  ValueID upper_bound(T value) const;
+
+  // same as upper_bound(T), but accepts an AllTypeVariant
+  ValueID upper_bound(const AllTypeVariant& value) const override;
+
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<pmr_vector<T>> _dictionary;
+  std::shared_ptr<BaseAttributeVector> _attribute_vector;
+  bool _nullable = false;
+};
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "column_iterables.hpp"
+#include "dictionary_column.hpp"
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DictionaryColumnIterable : public ColumnIterable<DictionaryColumnIterable<T>> {
+ public:
+  explicit DictionaryColumnIterable(const DictionaryColumn<T>& column)
+      : DictionaryColumnIterable{column, static_cast<ChunkOffset>(column.size())} {}
+
+  // iterates over the first size values only (see create_iterable_from_column)
+  DictionaryColumnIterable(const DictionaryColumn<T>& column, const ChunkOffset size) : _column{column}, _size{size} {}
+
+ private:
+  friend class ColumnIterable<DictionaryColumnIterable<T>>;
+
+  // the attribute vector is resolved once so that the iterator can decode value ids without virtual calls
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& dictionary = *_column.dictionary();
+    // columns that are not nullable never contain INVALID_VALUE_ID, so the iterator does not have to check for it
+    const auto null_value_id = _column.is_nullable() ? _column.null_value_id() : INVALID_VALUE_ID;
+
+    resolve_attribute_vector_type(*_column.attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+      functor(Iterator<AttributeVectorType>{dictionary, attribute_vector, null_value_id, ChunkOffset{0}},
+              Iterator<AttributeVectorType>{dictionary, attribute_vector, null_value_id, _size});
+    });
+  }
+
+  const DictionaryColumn<T>& _column;
+  const ChunkOffset _size;
+
+  template <typename AttributeVectorType>
+  class Iterator : public BaseColumnIterator<Iterator<AttributeVectorType>, ColumnIteratorValue<T>> {
+   public:
+    Iterator(const pmr_vector<T>& dictionary, const AttributeVectorType& attribute_vector,
+             const ValueID null_value_id, const ChunkOffset chunk_offset)
+        : _dictionary{&dictionary},
+          _attribute_vector{&attribute_vector},
+          _null_value_id{null_value_id},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - static_cast<std::ptrdiff_t>(_chunk_offset);
+    }
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto value_id = _attribute_vector->get(_chunk_offset);
+      if (value_id == _null_value_id) return ColumnIteratorValue<T>{{}, true, _chunk_offset};
+      return ColumnIteratorValue<T>{(*_dictionary)[value_id], false, _chunk_offset};
+    }
+
+   private:
+    const pmr_vector<T>* _dictionary;
+    const AttributeVectorType* _attribute_vector;
+    ValueID _null_value_id;
+    ChunkOffset _chunk_offset;
+  };
+};
+
+}  // namespace opossum
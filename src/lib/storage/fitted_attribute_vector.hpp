@@ -0,0 +1,51 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// FittedAttributeVector stores value ids in an unsigned integer type that is just wide enough
+// for the number of distinct values, i.e., uint8_t, uint16_t, or uint32_t
+template <typename uintX_t>
+class FittedAttributeVector : public BaseAttributeVector {
+  static_assert(std::is_unsigned<uintX_t>::value && sizeof(uintX_t) <= sizeof(ValueID::base_type),
+                "FittedAttributeVector requires an unsigned type not wider than ValueID");
+
+ public:
+  explicit FittedAttributeVector(const size_t size, const PolymorphicAllocator<uintX_t>& alloc = {})
+      : _value_ids(size, alloc) {}
+
+  // creates an attribute vector that takes over the given value ids without copying them
+  explicit FittedAttributeVector(pmr_vector<uintX_t>&& value_ids) : _value_ids(std::move(value_ids)) {}
+
+  // final allows calls through a FittedAttributeVector reference to be inlined (see resolve_attribute_vector_type)
+  ValueID get(const size_t i) const final { return ValueID{_value_ids[i]}; }
+
+  void set(const size_t i, const ValueID value_id) override {
+    DebugAssert(static_cast<ValueID::base_type>(value_id) <= std::numeric_limits<uintX_t>::max(),
+                "Value id does not fit into attribute vector");
+    _value_ids[i] = static_cast<uintX_t>(value_id);
+  }
+
+  size_t size() const override { return _value_ids.size(); }
+
+  AttributeVectorWidth width() const override { return sizeof(uintX_t); }
+
+  size_t estimate_memory_usage() const override { return sizeof(*this) + _value_ids.capacity() * sizeof(uintX_t); }
+
+  // returns the underlying data for typed access without virtual calls
+  const pmr_vector<uintX_t>& values() const { return _value_ids; }
+
+ private:
+  pmr_vector<uintX_t> _value_ids;
+};
+
+}  // namespace opossum
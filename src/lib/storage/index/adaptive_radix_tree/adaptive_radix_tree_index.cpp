@@ -0,0 +1,92 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex{ColumnIndexType::AdaptiveRadixTree},
+      _index_column{index_columns.size() == 1
+                        ? std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())
+                        : nullptr} {
+  Assert(index_columns.size() == 1, "AdaptiveRadixTreeIndex only works with a single column");
+  Assert(_index_column, "AdaptiveRadixTreeIndex only works with dictionary columns");
+
+  // sort the positions by their ValueID, so that every leaf points to a contiguous range. NULLs are not indexed
+  std::vector<size_t> value_id_offsets;
+  _sort_positions_by_value_id(*_index_column, value_id_offsets, _chunk_offsets);
+  const auto unique_values_count = _index_column->unique_values_count();
+
+  if (unique_values_count > 0) {
+    _root = _bulk_insert(0, static_cast<ValueID::base_type>(unique_values_count), 0, value_id_offsets);
+  }
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "AdaptiveRadixTreeIndex expects exactly one value");
+  const auto value_id = _index_column->lower_bound(values.front());
+  // INVALID_VALUE_ID means that all values are smaller than the search value
+  if (value_id == INVALID_VALUE_ID) return _cend();
+  return _root->lower_bound(_to_binary_comparable(value_id), 0);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "AdaptiveRadixTreeIndex expects exactly one value");
+  const auto value_id = _index_column->upper_bound(values.front());
+  if (value_id == INVALID_VALUE_ID) return _cend();
+  // the upper bound of the value is the lower bound of the next greater value in the dictionary
+  return _root->lower_bound(_to_binary_comparable(value_id), 0);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> AdaptiveRadixTreeIndex::_get_index_columns() const {
+  return {_index_column};
+}
+
+BinaryComparable AdaptiveRadixTreeIndex::_to_binary_comparable(const ValueID value_id) {
+  BinaryComparable key;
+  for (size_t depth = 0; depth < key.size(); ++depth) {
+    key[depth] = _partial_key(value_id, depth);
+  }
+  return key;
+}
+
+uint8_t AdaptiveRadixTreeIndex::_partial_key(const ValueID value_id, const size_t depth) {
+  return static_cast<uint8_t>(static_cast<ValueID::base_type>(value_id) >> (8 * (sizeof(ValueID) - 1 - depth)));
+}
+
+std::shared_ptr<const ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(const ValueID::base_type first,
+                                                                    const ValueID::base_type last, const size_t depth,
+                                                                    const std::vector<size_t>& value_id_offsets) const {
+  if (last - first == 1) {
+    return std::make_shared<ARTLeaf>(_to_binary_comparable(ValueID{first}),
+                                     _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(value_id_offsets[first]),
+                                     _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(value_id_offsets[last]));
+  }
+
+  // the keys are sorted, so all keys with the same byte at the current depth form a contiguous range
+  ARTInnerNode::Children children;
+  auto group_begin = first;
+  while (group_begin < last) {
+    const auto partial_key = _partial_key(ValueID{group_begin}, depth);
+    auto group_end = group_begin + 1;
+    while (group_end < last && _partial_key(ValueID{group_end}, depth) == partial_key) ++group_end;
+
+    children.emplace_back(partial_key, _bulk_insert(group_begin, group_end, depth + 1, value_id_offsets));
+    group_begin = group_end;
+  }
+
+  if (children.size() <= 4) return std::make_shared<ARTNode4>(children);
+  if (children.size() <= 16) return std::make_shared<ARTNode16>(children);
+  if (children.size() <= 48) return std::make_shared<ARTNode48>(children);
+  return std::make_shared<ARTNode256>(children);
+}
+
+}  // namespace opossum
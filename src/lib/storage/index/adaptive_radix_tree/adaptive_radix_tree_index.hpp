@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionaryColumn;
+
+// The AdaptiveRadixTreeIndex works on a single dictionary-encoded column. Like the GroupKeyIndex, it stores the
+// positions of all rows sorted by their ValueID. To find the positions of a ValueID, it uses an adaptive radix tree
+// (ART) as described by Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases" (ICDE 2013).
+//
+// The tree is keyed by the bytes of the ValueIDs (see BinaryComparable). Every inner node branches on one byte and
+// adapts its layout to the number of its children (ARTNode4, ARTNode16, ARTNode48, ARTNode256). Subtrees with a single
+// key are replaced by a leaf, which points to the positions of its ValueID. As the column is immutable, the tree is
+// bulk-loaded from the sorted keys and never modified afterwards.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const override;
+
+  static BinaryComparable _to_binary_comparable(const ValueID value_id);
+
+  // returns the byte of the ValueID's key at the given depth
+  static uint8_t _partial_key(const ValueID value_id, const size_t depth);
+
+  // builds the tree for the ValueIDs [first, last), whose keys share the first depth bytes.
+  // value_id_offsets holds the offset of the first position of every ValueID in _chunk_offsets.
+  std::shared_ptr<const ARTNode> _bulk_insert(const ValueID::base_type first, const ValueID::base_type last,
+                                              const size_t depth, const std::vector<size_t>& value_id_offsets) const;
+
+  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::shared_ptr<const ARTNode> _root;
+};
+
+}  // namespace opossum
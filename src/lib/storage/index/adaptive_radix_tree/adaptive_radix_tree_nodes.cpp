@@ -0,0 +1,102 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTNode::Iterator ARTInnerNode::lower_bound(const BinaryComparable& key, const size_t depth) const {
+  const auto [child, child_partial_key] = _first_child_not_less(key[depth]);
+  if (!child) return end();
+  // if the child holds greater keys only, its first key is the lower bound
+  return child_partial_key == key[depth] ? child->lower_bound(key, depth + 1) : child->begin();
+}
+
+ARTNode::Iterator ARTInnerNode::begin() const { return _first_child().begin(); }
+
+ARTNode::Iterator ARTInnerNode::end() const { return _last_child().end(); }
+
+template <size_t Capacity>
+ARTSortedNode<Capacity>::ARTSortedNode(const Children& children) : _child_count{static_cast<uint8_t>(children.size())} {
+  DebugAssert(!children.empty() && children.size() <= Capacity, "Invalid number of children");
+  for (uint8_t index = 0; index < _child_count; ++index) {
+    std::tie(_partial_keys[index], _children[index]) = children[index];
+  }
+}
+
+template <size_t Capacity>
+std::pair<const ARTNode*, uint8_t> ARTSortedNode<Capacity>::_first_child_not_less(const uint8_t partial_key) const {
+  const auto partial_keys_end = _partial_keys.cbegin() + _child_count;
+  const auto it = std::lower_bound(_partial_keys.cbegin(), partial_keys_end, partial_key);
+  if (it == partial_keys_end) return {nullptr, 0};
+  return {_children[std::distance(_partial_keys.cbegin(), it)].get(), *it};
+}
+
+template <size_t Capacity>
+const ARTNode& ARTSortedNode<Capacity>::_first_child() const {
+  return *_children.front();
+}
+
+template <size_t Capacity>
+const ARTNode& ARTSortedNode<Capacity>::_last_child() const {
+  return *_children[_child_count - 1];
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(const Children& children)
+    : _min_partial_key{children.front().first}, _max_partial_key{children.back().first} {
+  DebugAssert(children.size() <= 48, "Invalid number of children");
+  _child_index_by_partial_key.fill(EMPTY_SLOT);
+  for (uint8_t index = 0; index < children.size(); ++index) {
+    _child_index_by_partial_key[children[index].first] = index;
+    _children[index] = children[index].second;
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode48::_first_child_not_less(const uint8_t partial_key) const {
+  for (size_t key = std::max(partial_key, _min_partial_key); key <= _max_partial_key; ++key) {
+    const auto index = _child_index_by_partial_key[key];
+    if (index != EMPTY_SLOT) return {_children[index].get(), static_cast<uint8_t>(key)};
+  }
+  return {nullptr, 0};
+}
+
+const ARTNode& ARTNode48::_first_child() const { return *_children[_child_index_by_partial_key[_min_partial_key]]; }
+
+const ARTNode& ARTNode48::_last_child() const { return *_children[_child_index_by_partial_key[_max_partial_key]]; }
+
+ARTNode256::ARTNode256(const Children& children)
+    : _min_partial_key{children.front().first}, _max_partial_key{children.back().first} {
+  for (const auto& [partial_key, child] : children) {
+    _children[partial_key] = child;
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode256::_first_child_not_less(const uint8_t partial_key) const {
+  for (size_t key = std::max(partial_key, _min_partial_key); key <= _max_partial_key; ++key) {
+    if (_children[key]) return {_children[key].get(), static_cast<uint8_t>(key)};
+  }
+  return {nullptr, 0};
+}
+
+const ARTNode& ARTNode256::_first_child() const { return *_children[_min_partial_key]; }
+
+const ARTNode& ARTNode256::_last_child() const { return *_children[_max_partial_key]; }
+
+ARTLeaf::ARTLeaf(const BinaryComparable& key, const Iterator begin, const Iterator end)
+    : _key{key}, _begin{begin}, _end{end} {}
+
+ARTNode::Iterator ARTLeaf::lower_bound(const BinaryComparable& key, const size_t) const {
+  return key <= _key ? _begin : _end;
+}
+
+ARTNode::Iterator ARTLeaf::begin() const { return _begin; }
+
+ARTNode::Iterator ARTLeaf::end() const { return _end; }
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Keys of the adaptive radix tree are ValueIDs in big-endian byte order, so that comparing them byte by byte gives
+// the same order as comparing the ValueIDs.
+using BinaryComparable = std::array<uint8_t, sizeof(ValueID::base_type)>;
+
+// ARTNode is the abstract super class of the nodes of an adaptive radix tree (see AdaptiveRadixTreeIndex).
+// Every node covers the positions of all keys in its subtree, which are stored contiguously in the index.
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  ARTNode() = default;
+  virtual ~ARTNode() = default;
+
+  // returns an iterator to the positions of the first key in the subtree that is not smaller than the given key.
+  // The first depth bytes of the key are equal to the common prefix of all keys in the subtree.
+  virtual Iterator lower_bound(const BinaryComparable& key, const size_t depth) const = 0;
+
+  // return iterators to the positions of all keys in the subtree
+  virtual Iterator begin() const = 0;
+  virtual Iterator end() const = 0;
+};
+
+// An inner node maps the next byte of the key (the partial key) to the child that holds all keys with this byte.
+// The node types only differ in how they store their children, so that small nodes take little memory and large
+// nodes can be searched in constant time.
+class ARTInnerNode : public ARTNode {
+ public:
+  using Children = std::vector<std::pair<uint8_t, std::shared_ptr<const ARTNode>>>;
+
+  Iterator lower_bound(const BinaryComparable& key, const size_t depth) const final;
+  Iterator begin() const final;
+  Iterator end() const final;
+
+ protected:
+  // returns the child with the smallest partial key that is not smaller than the given one, or nullptr
+  virtual std::pair<const ARTNode*, uint8_t> _first_child_not_less(const uint8_t partial_key) const = 0;
+  virtual const ARTNode& _first_child() const = 0;
+  virtual const ARTNode& _last_child() const = 0;
+};
+
+// ARTNode4 and ARTNode16 store up to 4 / 16 partial keys in a sorted array, next to the array of their children
+template <size_t Capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  // the children have to be sorted by their partial keys
+  explicit ARTSortedNode(const Children& children);
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_not_less(const uint8_t partial_key) const override;
+  const ARTNode& _first_child() const override;
+  const ARTNode& _last_child() const override;
+
+  uint8_t _child_count;
+  std::array<uint8_t, Capacity> _partial_keys;
+  std::array<std::shared_ptr<const ARTNode>, Capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// ARTNode48 stores up to 48 children. An array indexed by the partial key holds the position of the child.
+class ARTNode48 : public ARTInnerNode {
+ public:
+  explicit ARTNode48(const Children& children);
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_not_less(const uint8_t partial_key) const override;
+  const ARTNode& _first_child() const override;
+  const ARTNode& _last_child() const override;
+
+  // marks partial keys without a child
+  static constexpr uint8_t EMPTY_SLOT = 48;
+
+  std::array<uint8_t, 256> _child_index_by_partial_key;
+  std::array<std::shared_ptr<const ARTNode>, 48> _children;
+  uint8_t _min_partial_key;
+  uint8_t _max_partial_key;
+};
+
+// ARTNode256 stores the children directly in an array indexed by the partial key
+class ARTNode256 : public ARTInnerNode {
+ public:
+  explicit ARTNode256(const Children& children);
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_not_less(const uint8_t partial_key) const override;
+  const ARTNode& _first_child() const override;
+  const ARTNode& _last_child() const override;
+
+  std::array<std::shared_ptr<const ARTNode>, 256> _children;
+  uint8_t _min_partial_key;
+  uint8_t _max_partial_key;
+};
+
+// A leaf holds the positions of a single key. Subtrees that only hold one key are replaced by a leaf right away
+// (lazy expansion), which is why the leaf compares the complete key.
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(const BinaryComparable& key, const Iterator begin, const Iterator end);
+
+  Iterator lower_bound(const BinaryComparable& key, const size_t depth) const override;
+  Iterator begin() const override;
+  Iterator end() const override;
+
+ protected:
+  const BinaryComparable _key;
+  const Iterator _begin;
+  const Iterator _end;
+};
+
+}  // namespace opossum
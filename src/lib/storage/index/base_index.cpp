@@ -0,0 +1,66 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const ColumnIndexType type) : _type{type} {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  return _get_index_columns() == columns;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(_get_index_columns().size() >= values.size(), "Index does not cover as many columns as values given");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(_get_index_columns().size() >= values.size(), "Index does not cover as many columns as values given");
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+ColumnIndexType BaseIndex::type() const { return _type; }
+
+void BaseIndex::_sort_positions_by_value_id(const BaseDictionaryColumn& column, std::vector<size_t>& offsets,
+                                            std::vector<ChunkOffset>& positions) {
+  // count the rows of every ValueID, compute the offsets of the groups by a prefix sum, and finally write every
+  // position into its group
+  offsets.assign(column.unique_values_count() + 1, 0u);
+  const auto nullable = column.is_nullable();
+  const auto null_value_id = static_cast<ValueID::base_type>(column.null_value_id());
+
+  resolve_attribute_vector_type(*column.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto column_size = attribute_vector.size();
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < column_size; ++chunk_offset) {
+      const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset));
+      if (nullable && value_id == null_value_id) continue;
+      ++offsets[value_id + 1];
+    }
+
+    for (size_t value_id = 1; value_id < offsets.size(); ++value_id) {
+      offsets[value_id] += offsets[value_id - 1];
+    }
+    positions.resize(offsets.back());
+
+    auto next_positions = offsets;
+    for (ChunkOffset chunk_offset = 0; chunk_offset < column_size; ++chunk_offset) {
+      const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(chunk_offset));
+      if (nullable && value_id == null_value_id) continue;
+      positions[next_positions[value_id]++] = chunk_offset;
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class BaseDictionaryColumn;
+
+// BaseIndex is the abstract super class for all secondary indices of a chunk, e.g., GroupKeyIndex and
+// AdaptiveRadixTreeIndex. An index is built once for one or more immutable columns of a chunk.
+//
+// It provides the positions (ChunkOffsets) of the indexed rows in the order of their values. lower_bound and
+// upper_bound return iterators into this sequence, so that the positions of all rows whose values lie in a range
+// are given by [lower_bound(lower), upper_bound(upper)). For example, these are the positions of all rows with the
+// value 42 in the indexed column:
+//
+//   const auto begin = index->lower_bound({42});
+//   const auto end = index->upper_bound({42});
+//   for (auto it = begin; it != end; ++it) process(*it);
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const ColumnIndexType type);
+  virtual ~BaseIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns whether the index covers exactly the given columns, in this order
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
+
+  // returns an iterator to the position of the first row whose values are not smaller than the given ones
+  // (one value per indexed column)
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the position of the first row whose values are greater than the given ones
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // return iterators to the positions of all indexed rows
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  ColumnIndexType type() const;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const = 0;
+
+  // sorts the positions of the rows of a dictionary column by their ValueID (counting sort). offsets receives the
+  // offset of the first position of every ValueID in positions, followed by the number of positions.
+  // NULLs (see BaseDictionaryColumn::null_value_id) are not indexed, as they never match a predicate
+  static void _sort_positions_by_value_id(const BaseDictionaryColumn& column, std::vector<size_t>& offsets,
+                                          std::vector<ChunkOffset>& positions);
+
+ private:
+  ColumnIndexType _type;
+};
+
+}  // namespace opossum
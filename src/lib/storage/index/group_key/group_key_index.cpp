@@ -0,0 +1,46 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex{ColumnIndexType::GroupKey},
+      _index_column{index_columns.size() == 1
+                        ? std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())
+                        : nullptr} {
+  Assert(index_columns.size() == 1, "GroupKeyIndex only works with a single column");
+  Assert(_index_column, "GroupKeyIndex only works with dictionary columns");
+
+  // the positions are grouped by their ValueID, NULLs are not indexed
+  _sort_positions_by_value_id(*_index_column, _index_offsets, _index_postings);
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "GroupKeyIndex expects exactly one value");
+  return _get_postings_iterator_at(_index_column->lower_bound(values.front()));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "GroupKeyIndex expects exactly one value");
+  return _get_postings_iterator_at(_index_column->upper_bound(values.front()));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cbegin() const { return _index_postings.cbegin(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cend() const { return _index_postings.cend(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> GroupKeyIndex::_get_index_columns() const { return {_index_column}; }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_get_postings_iterator_at(const ValueID value_id) const {
+  // INVALID_VALUE_ID means that all values are smaller than the search value
+  if (value_id == INVALID_VALUE_ID) return _index_postings.cend();
+  const auto offset = _index_offsets[static_cast<ValueID::base_type>(value_id)];
+  return _index_postings.cbegin() + static_cast<std::ptrdiff_t>(offset);
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionaryColumn;
+
+// The GroupKeyIndex works on a single dictionary-encoded column. It stores the positions of all rows grouped by
+// their ValueID (_index_postings) and, for every ValueID, the offset of its first position in _index_postings
+// (_index_offsets). As the dictionary is sorted, a lookup only translates the search value into a ValueID and returns
+// the corresponding offset. Within a group, positions are sorted in ascending order.
+//
+// Example: for the column [b, a, c, a] with the dictionary [a, b, c], i.e., the ValueIDs [1, 0, 2, 0],
+//   _index_offsets  = [0, 2, 3, 4]
+//   _index_postings = [1, 3, 0, 2]
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const override;
+
+  // returns the iterator to the first position of the group of the given ValueID
+  Iterator _get_postings_iterator_at(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  std::vector<size_t> _index_offsets;
+  std::vector<ChunkOffset> _index_postings;
+};
+
+}  // namespace opossum
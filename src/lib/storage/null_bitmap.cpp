@@ -0,0 +1,85 @@
+#include "null_bitmap.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NullBitmap::NullBitmap(const PolymorphicAllocator<uint64_t>& alloc) : _words(alloc) {}
+
+NullBitmap::NullBitmap(const size_t size, const PolymorphicAllocator<uint64_t>& alloc)
+    : _size{size}, _words(word_count(size), 0u, alloc) {}
+
+NullBitmap::NullBitmap(const size_t size, pmr_vector<uint64_t>&& words) : _size{size}, _words{std::move(words)} {
+  Assert(_words.size() == word_count(size), "Number of words does not match the size of the null bitmap");
+  const auto used_bits = size % BITS_PER_WORD;
+  Assert(used_bits == 0 || (_words.back() >> used_bits) == 0, "Bits beyond the size of the null bitmap are set");
+}
+
+void NullBitmap::set_null(const size_t index, const bool is_null) {
+  DebugAssert(index < _size, "Position out of range");
+  const auto mask = uint64_t{1} << (index % BITS_PER_WORD);
+  auto& word = _words[index / BITS_PER_WORD];
+  word = is_null ? word | mask : word & ~mask;
+}
+
+void NullBitmap::push_back(const bool is_null) {
+  if (_size % BITS_PER_WORD == 0) _words.push_back(0u);
+  if (is_null) _words.back() |= uint64_t{1} << (_size % BITS_PER_WORD);
+  ++_size;
+}
+
+void NullBitmap::append(const NullBitmap& other, const size_t offset, const size_t count) {
+  DebugAssert(offset + count <= other._size, "Positions out of range");
+
+  if (_size % BITS_PER_WORD == 0 && offset % BITS_PER_WORD == 0) {
+    // both bitmaps are aligned, so whole words can be copied. Only the bits of the last one may have to be cleared.
+    const auto first = other._words.cbegin() + static_cast<std::ptrdiff_t>(offset / BITS_PER_WORD);
+    _words.insert(_words.end(), first, first + static_cast<std::ptrdiff_t>(word_count(count)));
+    _size += count;
+    if (_size % BITS_PER_WORD != 0) _words.back() &= (uint64_t{1} << (_size % BITS_PER_WORD)) - 1;
+    return;
+  }
+
+  reserve(_size + count);
+  for (auto index = offset; index < offset + count; ++index) {
+    push_back(other.is_null(index));
+  }
+}
+
+void NullBitmap::append_non_null(const size_t count) {
+  _size += count;
+  _words.resize(word_count(_size), 0u);
+}
+
+void NullBitmap::reserve(const size_t capacity) { _words.reserve(word_count(capacity)); }
+
+void NullBitmap::clear() {
+  _size = 0;
+  _words.clear();
+}
+
+size_t NullBitmap::size() const { return _size; }
+
+size_t NullBitmap::null_count(const size_t count) const {
+  DebugAssert(count <= _size, "Positions out of range");
+  size_t null_count = 0;
+  const auto full_words = count / BITS_PER_WORD;
+  for (size_t word_index = 0; word_index < full_words; ++word_index) {
+    null_count += static_cast<size_t>(__builtin_popcountll(_words[word_index]));
+  }
+  if (count % BITS_PER_WORD != 0) {
+    const auto mask = (uint64_t{1} << (count % BITS_PER_WORD)) - 1;
+    null_count += static_cast<size_t>(__builtin_popcountll(_words[full_words] & mask));
+  }
+  return null_count;
+}
+
+size_t NullBitmap::null_count() const { return null_count(_size); }
+
+const pmr_vector<uint64_t>& NullBitmap::words() const { return _words; }
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// NullBitmap stores for every value of a column whether it is NULL, packed into 64 bit words (bit i of word w belongs
+// to position 64 * w + i). Bits beyond size() are always unset. Only nullable columns have a null bitmap, so columns
+// that cannot contain NULLs do not pay for it.
+class NullBitmap {
+ public:
+  static constexpr size_t BITS_PER_WORD = 64;
+
+  NullBitmap() = default;
+
+  // creates an empty bitmap whose words are allocated by the given allocator
+  explicit NullBitmap(const PolymorphicAllocator<uint64_t>& alloc);
+
+  // creates a bitmap of the given size in which no value is NULL
+  explicit NullBitmap(const size_t size, const PolymorphicAllocator<uint64_t>& alloc = {});
+
+  // creates a bitmap from its words, e.g., when loading a table
+  NullBitmap(const size_t size, pmr_vector<uint64_t>&& words);
+
+  bool is_null(const size_t index) const { return (_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1u; }
+
+  void set_null(const size_t index, const bool is_null);
+
+  // adds a position to the end
+  void push_back(const bool is_null);
+
+  // adds count positions of other, starting at offset, to the end
+  void append(const NullBitmap& other, const size_t offset, const size_t count);
+
+  // adds count positions that are not NULL to the end
+  void append_non_null(const size_t count);
+
+  // reserves memory for capacity positions, so that appending does not reallocate the words
+  void reserve(const size_t capacity);
+
+  void clear();
+
+  size_t size() const;
+
+  // returns the number of NULLs among the first count positions
+  size_t null_count(const size_t count) const;
+  size_t null_count() const;
+
+  const pmr_vector<uint64_t>& words() const;
+
+  // returns the number of bytes allocated for the words, including unused capacity
+  size_t allocated_bytes() const { return _words.capacity() * sizeof(uint64_t); }
+
+  // returns the number of words needed for size positions
+  static size_t word_count(const size_t size) { return (size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+ private:
+  size_t _size = 0;
+  pmr_vector<uint64_t> _words;
+};
+
+// Calls functor(index) for every index in [0, size) whose value is not NULL. The bitmap is processed word by word:
+// words without NULLs do not look at single bits and words that consist of NULLs only are skipped at once.
+template <typename Functor>
+void for_each_non_null(const NullBitmap& null_values, const size_t size, const Functor& functor) {
+  const auto& words = null_values.words();
+
+  for (size_t word_begin = 0; word_begin < size; word_begin += NullBitmap::BITS_PER_WORD) {
+    const auto nulls = words[word_begin / NullBitmap::BITS_PER_WORD];
+    const auto word_end = std::min(word_begin + NullBitmap::BITS_PER_WORD, size);
+
+    if (nulls == 0) {
+      for (auto index = word_begin; index < word_end; ++index) functor(index);
+    } else if (nulls != ~uint64_t{0}) {
+      for (auto index = word_begin; index < word_end; ++index) {
+        if (!((nulls >> (index - word_begin)) & 1u)) functor(index);
+      }
+    }
+  }
+}
+
+// Same as above, for columns that might not be nullable. If null_values is nullptr, no value is NULL.
+template <typename Functor>
+void for_each_non_null(const NullBitmap* null_values, const size_t size, const Functor& functor) {
+  if (null_values) return for_each_non_null(*null_values, size, functor);
+  for (size_t index = 0; index < size; ++index) functor(index);
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include "reference_column.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {
+  DebugAssert(referenced_column_id < referenced_table->col_count(), "Referenced column does not exist");
+}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  const auto& row_id = _pos_list->at(i);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(_referenced_column_id))[row_id.chunk_offset];
+}
+
+void ReferenceColumn::append(const AllTypeVariant&) { Fail("Reference columns are immutable"); }
+
+AllTypeVariant ReferenceColumn::cast_value(const AllTypeVariant&) const {
+  Fail("Reference columns are immutable");
+  return NULL_VALUE;
+}
+
+size_t ReferenceColumn::size() const { return _pos_list->size(); }
+
+size_t ReferenceColumn::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(PosList) + _pos_list->capacity() * sizeof(RowID);
+}
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
+
+std::shared_ptr<Table> make_reference_table(const std::shared_ptr<const Table>& table,
+                                            const std::shared_ptr<const PosList>& pos_list) {
+  auto reference_table = std::make_shared<Table>();
+  auto& reference_chunk = reference_table->get_chunk(ChunkID{0});
+
+  // Columns that stem from the same operator share their position lists. Resolving them results in the same position
+  // list again, so it is only done once per combination of input position lists.
+  std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+    reference_table->add_column_definition(table->column_name(column_id), table->column_type(column_id),
+                                           table->column_is_nullable(column_id));
+
+    // collect the reference columns of all chunks, if the column consists of reference columns
+    std::vector<std::shared_ptr<const ReferenceColumn>> input_columns;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (chunk.col_count() == 0) {
+        input_columns.push_back(nullptr);
+        continue;
+      }
+      input_columns.push_back(std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(column_id)));
+    }
+
+    const auto first_reference_column =
+        std::find_if(input_columns.cbegin(), input_columns.cend(), [](const auto& column) { return column; });
+    if (first_reference_column == input_columns.cend()) {
+      reference_chunk.add_column(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+      continue;
+    }
+
+    const auto referenced_table = (*first_reference_column)->referenced_table();
+    const auto referenced_column_id = (*first_reference_column)->referenced_column_id();
+
+    std::vector<std::shared_ptr<const PosList>> input_pos_lists;
+    for (ChunkID chunk_id{0}; chunk_id < input_columns.size(); ++chunk_id) {
+      const auto& input_column = input_columns[chunk_id];
+      if (!input_column) {
+        Assert(table->get_chunk(chunk_id).size() == 0, "Tables must not mix reference and value columns");
+        input_pos_lists.push_back(nullptr);
+        continue;
+      }
+      Assert(input_column->referenced_table() == referenced_table &&
+                 input_column->referenced_column_id() == referenced_column_id,
+             "All chunks of a reference table have to reference the same column");
+      input_pos_lists.push_back(input_column->pos_list());
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list) {
+      auto positions = std::make_shared<PosList>();
+      positions->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        DebugAssert(row_id.chunk_id < input_pos_lists.size() && input_pos_lists[row_id.chunk_id],
+                    "Position does not exist");
+        positions->push_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+      resolved_pos_list = positions;
+    }
+
+    reference_chunk.add_column(
+        std::make_shared<ReferenceColumn>(referenced_table, referenced_column_id, resolved_pos_list));
+  }
+
+  return reference_table;
+}
+
+}  // namespace opossum
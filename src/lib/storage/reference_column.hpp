@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceColumn is a specific column type that does not store any values itself. Instead, it references the values
+// of a column of another table via a list of positions. Operators (e.g., TableScan) use it to pass on their results
+// without copying the values. Multiple reference columns may share the same position list.
+class ReferenceColumn : public BaseColumn {
+ public:
+  // creates a reference column
+  // the referenced table must contain the actual values, i.e., it must not consist of reference columns itself
+  ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                  const std::shared_ptr<const PosList> pos);
+
+  // return the value at a certain position. Resolves the referenced chunk and column for every call. Back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // reference columns are immutable
+  void append(const AllTypeVariant& val) override;
+  AllTypeVariant cast_value(const AllTypeVariant& val) const override;
+
+  // return the number of referenced positions
+  size_t size() const override;
+
+  // the referenced values are not included. The position list is, even though it may be shared with other columns.
+  size_t estimate_memory_usage() const override;
+
+  // returns the positions of the referenced rows, in the order of this column
+  const std::shared_ptr<const PosList> pos_list() const;
+
+  // returns the table that holds the referenced values
+  const std::shared_ptr<const Table> referenced_table() const;
+
+  // returns the id of the referenced column within the referenced table
+  ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+// Creates a table with the schema of the given table that consists of one chunk of reference columns pointing to the
+// rows at the given positions, e.g., to pass on the result of a TableScan to the next operator.
+// If the given table consists of reference columns itself, its positions are resolved, so that the new table
+// references the table holding the actual values directly instead of building chains of references.
+std::shared_ptr<Table> make_reference_table(const std::shared_ptr<const Table>& table,
+                                            const std::shared_ptr<const PosList>& pos_list);
+
+}  // namespace opossum
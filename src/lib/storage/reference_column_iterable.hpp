@@ -0,0 +1,114 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "column_iterables.hpp"
+#include "reference_column.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>> {
+ public:
+  explicit ReferenceColumnIterable(const ReferenceColumn& column)
+      : ReferenceColumnIterable{column, static_cast<ChunkOffset>(column.size())} {}
+
+  // iterates over the first size positions only (see create_iterable_from_column)
+  ReferenceColumnIterable(const ReferenceColumn& column, const ChunkOffset size) : _column{column}, _size{size} {}
+
+ private:
+  friend class ColumnIterable<ReferenceColumnIterable<T>>;
+
+  // provides typed access to the referenced column of one chunk of the referenced table
+  struct ChunkAccessor {
+    ColumnIteratorValue<T> get(const ChunkOffset chunk_offset, const ChunkOffset position) const {
+      if (values) {
+        const auto is_null = null_values && null_values->is_null(chunk_offset);
+        return ColumnIteratorValue<T>{(*values)[chunk_offset], is_null, position};
+      }
+      const auto value_id = attribute_vector->get(chunk_offset);
+      if (value_id == null_value_id) return ColumnIteratorValue<T>{{}, true, position};
+      return ColumnIteratorValue<T>{(*dictionary)[value_id], false, position};
+    }
+
+    const ValueVector<T>* values = nullptr;
+    const NullBitmap* null_values = nullptr;
+    const pmr_vector<T>* dictionary = nullptr;
+    const BaseAttributeVector* attribute_vector = nullptr;
+    ValueID null_value_id = INVALID_VALUE_ID;
+  };
+
+  // the referenced columns are resolved once per referenced chunk instead of once per position
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& referenced_table = *_column.referenced_table();
+    const auto chunk_count = referenced_table.chunk_count();
+
+    // keeps the referenced columns alive in case they are replaced concurrently (see Chunk::replace_column)
+    std::vector<std::shared_ptr<const BaseColumn>> referenced_columns;
+    referenced_columns.reserve(chunk_count);
+    std::vector<ChunkAccessor> accessors(chunk_count);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      referenced_columns.push_back(referenced_table.get_chunk(chunk_id).get_column(_column.referenced_column_id()));
+
+      resolve_column_type<T>(*referenced_columns.back(), [&](const auto& typed_column) {
+        using ColumnType = std::decay_t<decltype(typed_column)>;
+
+        if constexpr (std::is_same<ColumnType, ValueColumn<T>>::value) {
+          accessors[chunk_id].values = &typed_column.values();
+          if (typed_column.is_nullable()) accessors[chunk_id].null_values = &typed_column.null_values();
+        } else if constexpr (std::is_same<ColumnType, DictionaryColumn<T>>::value) {
+          accessors[chunk_id].dictionary = typed_column.dictionary().get();
+          accessors[chunk_id].attribute_vector = typed_column.attribute_vector().get();
+          if (typed_column.is_nullable()) accessors[chunk_id].null_value_id = typed_column.null_value_id();
+        } else {
+          Fail("Reference columns must not reference other reference columns");
+        }
+      });
+    }
+
+    const auto& pos_list = *_column.pos_list();
+    functor(Iterator{accessors, pos_list, ChunkOffset{0}}, Iterator{accessors, pos_list, _size});
+  }
+
+  const ReferenceColumn& _column;
+  const ChunkOffset _size;
+
+  class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
+   public:
+    Iterator(const std::vector<ChunkAccessor>& accessors, const PosList& pos_list, const ChunkOffset chunk_offset)
+        : _accessors{&accessors}, _pos_list{&pos_list}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - static_cast<std::ptrdiff_t>(_chunk_offset);
+    }
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto& row_id = (*_pos_list)[_chunk_offset];
+      return (*_accessors)[row_id.chunk_id].get(row_id.chunk_offset, _chunk_offset);
+    }
+
+   private:
+    const std::vector<ChunkAccessor>* _accessors;
+    const PosList* _pos_list;
+    ChunkOffset _chunk_offset;
+  };
+};
+
+}  // namespace opossum
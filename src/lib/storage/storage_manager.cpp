@@ -1,6 +1,10 @@
 #include "storage_manager.hpp"
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,25 +19,36 @@ StorageManager& StorageManager::get() {
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  if (has_table(name)) {
+  std::unique_lock<std::shared_mutex> lock(_tables_mutex);
+  if (!_tables.insert(std::pair<std::string, std::shared_ptr<Table>>(name, table)).second) {
     throw std::runtime_error("Table already exists");
   }
-  _tables.insert(std::pair<std::string, std::shared_ptr<Table>>(name, table));
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  _check_table_existence(name);
-  _tables.erase(name);
+  std::shared_ptr<Table> dropped_table;
+  {
+    std::unique_lock<std::shared_mutex> lock(_tables_mutex);
+    _check_table_existence(name);
+    // the table is destroyed outside of the lock (unless someone else still holds it) so that readers are not blocked
+    dropped_table = std::move(_tables.at(name));
+    _tables.erase(name);
+  }
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(_tables_mutex);
   _check_table_existence(name);
   return _tables.at(name);
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name) != 0; }
+bool StorageManager::has_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(_tables_mutex);
+  return _tables.count(name) != 0;
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::shared_lock<std::shared_mutex> lock(_tables_mutex);
   std::vector<std::string> names;
   for (const auto& _table : _tables) {
     names.push_back(_table.first);
@@ -42,6 +57,7 @@ std::vector<std::string> StorageManager::table_names() const {
 }
 
 void StorageManager::print(std::ostream& out) const {
+  std::shared_lock<std::shared_mutex> lock(_tables_mutex);
   _print_header(out);
   for (const auto& _table : _tables) {
     _print_table_information(out, _table.first, _table.second);
@@ -51,22 +67,30 @@ void StorageManager::print(std::ostream& out) const {
 void StorageManager::_print_table_information(std::ostream& out, const std::string& name,
                                               const std::shared_ptr<Table>& table) const {
   std::stringstream line;
-  line << name << " (" << table->col_count() << ", " << table->row_count() << ", " << table->chunk_count() << ")\n";
+  line << name << " (" << table->col_count() << ", " << table->row_count() << ", " << table->chunk_count() << ", "
+       << table->estimate_memory_usage() << ")\n";
+  for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+    line << "  " << table->column_name(column_id) << " (" << table->column_type(column_id) << ", "
+         << table->estimate_memory_usage(column_id) << ")\n";
+  }
   out.write(line.str().c_str(), line.str().size());
 }
 
 void StorageManager::_print_header(std::ostream& out) const {
-  std::string header = "Table Name (#Columns, #Rows, #Chunks)\n";
+  std::string header = "Table Name (#Columns, #Rows, #Chunks, #Bytes)\n  Column Name (Type, #Bytes)\n";
   out.write(header.c_str(), header.size());
 }
 
 void StorageManager::reset() {
-  // write the new instance returned by StorageManager() to the address returned by get()
-  get() = StorageManager();
+  auto& storage_manager = get();
+  std::unique_lock<std::shared_mutex> lock(storage_manager._tables_mutex);
+  auto tables = std::move(storage_manager._tables);
+  storage_manager._tables.clear();
+  lock.unlock();
 }
 
 void StorageManager::_check_table_existence(const std::string& name) const {
-  if (!has_table(name)) {
+  if (_tables.count(name) == 0) {
     throw std::runtime_error("No such table");
   }
 }
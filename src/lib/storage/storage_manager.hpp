@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,10 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// All methods are thread-safe. Lookups (get_table, has_table, ...) share a reader lock and do not block each
+// other; add_table and drop_table take the lock exclusively. Tables are handed out as shared_ptrs, so dropping
+// a table does not affect readers that still use it.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -34,18 +39,20 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
-  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
+  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks, estimated memory
+  // usage in bytes), each followed by the estimated memory usage of its columns (see Table::estimate_memory_usage)
   void print(std::ostream& out = std::cout) const;
 
-  // deletes the entire StorageManager and creates a new one, used especially in tests
+  // deletes all tables from the StorageManager, used especially in tests
   static void reset();
 
  private:
   std::map<std::string, std::shared_ptr<Table>> _tables;
+  mutable std::shared_mutex _tables_mutex;
 
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
 
+  // expects the caller to hold _tables_mutex
   void _check_table_existence(const std::string& name) const;
 
   void _print_header(std::ostream& out) const;
@@ -0,0 +1,149 @@
+#include "string_vector.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringVector::StringVector(const PolymorphicAllocator<char>& alloc)
+    : _chars(alloc), _offsets(alloc), _prefixes(alloc) {}
+
+StringVector::StringVector(const StringVector& other)
+    : _chars(other._chars), _char_data{_chars.data()}, _offsets(other._offsets), _prefixes(other._prefixes) {}
+
+StringVector::StringVector(StringVector&& other) noexcept
+    : _chars(std::move(other._chars)),
+      _retired_chars(std::move(other._retired_chars)),
+      _char_data{_chars.data()},
+      _offsets(std::move(other._offsets)),
+      _prefixes(std::move(other._prefixes)) {
+  other._char_data.store(other._chars.data());
+}
+
+StringVector& StringVector::operator=(const StringVector& other) {
+  if (this == &other) return *this;
+  _chars = other._chars;
+  _retired_chars.clear();
+  _char_data.store(_chars.data(), std::memory_order_release);
+  _offsets = other._offsets;
+  _prefixes = other._prefixes;
+  return *this;
+}
+
+StringVector& StringVector::operator=(StringVector&& other) noexcept {
+  if (this == &other) return *this;
+  // buffers of different allocators are copied instead of moved, so the data pointers are taken afterwards
+  _chars = std::move(other._chars);
+  _retired_chars = std::move(other._retired_chars);
+  _char_data.store(_chars.data(), std::memory_order_release);
+  other._char_data.store(other._chars.data());
+  _offsets = std::move(other._offsets);
+  _prefixes = std::move(other._prefixes);
+  return *this;
+}
+
+StringVector::StringVector(const std::vector<std::string>& strings, const PolymorphicAllocator<char>& alloc)
+    : StringVector(alloc) {
+  auto char_count = size_t{0};
+  for (const auto& string : strings) char_count += string.size();
+  reserve(strings.size(), char_count);
+  for (const auto& string : strings) push_back(string);
+}
+
+std::string_view StringVector::at(const size_t index) const {
+  Assert(index < size(), "Position out of range");
+  return (*this)[index];
+}
+
+void StringVector::push_back(const std::string_view string) {
+  if (_offsets.empty()) _offsets.push_back(0);
+  _ensure_char_capacity(size() + 1, _chars.size() + string.size());
+  _chars.insert(_chars.end(), string.cbegin(), string.cend());
+  _offsets.push_back(_chars.size());
+  _prefixes.push_back(make_prefix(string));
+}
+
+void StringVector::append(const StringVector& other, const size_t offset, const size_t count) {
+  DebugAssert(offset + count <= other.size(), "Positions out of range");
+  if (count == 0) return;
+
+  if (_offsets.empty()) _offsets.push_back(0);
+  const auto chars_begin = other._offsets[offset];
+  const auto chars_end = other._offsets[offset + count];
+  const auto shift = _chars.size() - chars_begin;
+
+  _ensure_char_capacity(size() + count, _chars.size() + chars_end - chars_begin);
+  _chars.insert(_chars.end(), other._chars.cbegin() + static_cast<std::ptrdiff_t>(chars_begin),
+                other._chars.cbegin() + static_cast<std::ptrdiff_t>(chars_end));
+
+  const auto first = static_cast<std::ptrdiff_t>(offset);
+  const auto last = static_cast<std::ptrdiff_t>(offset + count);
+  // the end offsets of the appended strings, i.e., the begin offsets of their successors
+  _offsets.reserve(_offsets.size() + count);
+  std::transform(other._offsets.cbegin() + first + 1, other._offsets.cbegin() + last + 1, std::back_inserter(_offsets),
+                 [&](const size_t end_offset) { return end_offset + shift; });
+  _prefixes.insert(_prefixes.end(), other._prefixes.cbegin() + first, other._prefixes.cbegin() + last);
+}
+
+void StringVector::reserve(const size_t string_count, const size_t char_count) {
+  if (char_count > _chars.capacity()) _replace_chars(char_count);
+  _offsets.reserve(string_count + 1);
+  _prefixes.reserve(string_count);
+}
+
+void StringVector::clear() {
+  _chars.clear();
+  _retired_chars.clear();
+  _offsets.clear();
+  _prefixes.clear();
+}
+
+size_t StringVector::allocated_bytes() const {
+  auto bytes = _chars.capacity() + _offsets.capacity() * sizeof(size_t) + _prefixes.capacity() * sizeof(uint32_t);
+  for (const auto& chars : _retired_chars) bytes += chars.capacity();
+  return bytes;
+}
+
+void StringVector::_ensure_char_capacity(const size_t string_count, const size_t char_count) {
+  if (char_count <= _chars.capacity()) return;
+
+  auto capacity = std::max(char_count, 2 * _chars.capacity());
+  // assuming that the remaining reserved strings are as long as the ones so far, the buffer is replaced only rarely
+  if (string_count < _prefixes.capacity()) {
+    capacity = std::max(capacity, (char_count * _prefixes.capacity() + string_count - 1) / string_count);
+  }
+  _replace_chars(capacity);
+}
+
+void StringVector::_replace_chars(const size_t capacity) {
+  pmr_vector<char> chars(_chars.get_allocator());
+  chars.reserve(capacity);
+  chars.insert(chars.end(), _chars.cbegin(), _chars.cend());
+
+  // moving the retired buffer (with the same allocator) keeps its memory in place
+  if (_chars.capacity() > 0) _retired_chars.push_back(std::move(_chars));
+  _chars = std::move(chars);
+  _char_data.store(_chars.data(), std::memory_order_release);
+}
+
+StringVector::Iterator StringVector::begin() const { return Iterator{this, 0}; }
+StringVector::Iterator StringVector::end() const { return Iterator{this, size()}; }
+StringVector::Iterator StringVector::cbegin() const { return begin(); }
+StringVector::Iterator StringVector::cend() const { return end(); }
+
+uint32_t StringVector::make_prefix(const std::string_view string) {
+  auto prefix = uint32_t{0};
+  for (size_t index = 0; index < 4; ++index) {
+    const auto character = index < string.size() ? static_cast<unsigned char>(string[index]) : 0u;
+    prefix = (prefix << 8) | character;
+  }
+  return prefix;
+}
+
+}  // namespace opossum
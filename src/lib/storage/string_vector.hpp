@@ -0,0 +1,152 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * StringVector stores strings back to back in a single character buffer, together with the offset at which every
+ * string begins. Compared to a std::vector<std::string>, strings do not need allocations of their own, so that a
+ * chunk of a million strings needs three allocations instead of a million and scans read the strings in order.
+ *
+ * For every string, the first four characters are kept as a big-endian integer prefix (padded with zeros). Strings
+ * whose prefixes differ compare like their prefixes, so most comparisons in a scan do not touch the characters at all.
+ *
+ * Like the values of other ValueColumns, strings may be read while further strings are appended, as long as the number
+ * of strings has been reserved. The number of characters is usually not known in advance, though. So, when the
+ * character buffer runs full, it is not reallocated but replaced by a larger copy, and the previous buffer is kept
+ * until the vector is cleared or destroyed. Readers and the std::string_views they hold thus never refer to freed
+ * memory. To keep these retired buffers small, a new buffer is sized for the reserved number of strings, assuming that
+ * they are as long as the ones so far. All buffers are allocated by the allocator the StringVector was created with.
+ */
+class StringVector {
+ public:
+  class Iterator;
+
+  using value_type = std::string_view;
+  using const_iterator = Iterator;
+  using iterator = Iterator;
+
+  StringVector() = default;
+
+  explicit StringVector(const PolymorphicAllocator<char>& alloc);
+
+  // copies the given strings, so that vectors of strings can be used wherever a StringVector is expected
+  StringVector(const std::vector<std::string>& strings,  // NOLINT(runtime/explicit)
+               const PolymorphicAllocator<char>& alloc = {});
+
+  // copies and moves must not run concurrently to other operations on either vector. Copies do not retain any buffers
+  // of the original besides the current one.
+  StringVector(const StringVector& other);
+  StringVector(StringVector&& other) noexcept;
+  StringVector& operator=(const StringVector& other);
+  StringVector& operator=(StringVector&& other) noexcept;
+
+  std::string_view operator[](const size_t index) const {
+    // acquire semantics make sure that the characters copied into a new buffer are seen along with the buffer
+    return std::string_view{_char_data.load(std::memory_order_acquire) + _offsets[index],
+                            _offsets[index + 1] - _offsets[index]};
+  }
+
+  // like operator[], but checks that the position exists
+  std::string_view at(const size_t index) const;
+
+  void push_back(const std::string_view string);
+
+  // adds count strings of other, starting at offset, to the end
+  void append(const StringVector& other, const size_t offset, const size_t count);
+
+  // reserves memory for string_count strings and char_count characters in total
+  void reserve(const size_t string_count, const size_t char_count = 0);
+
+  void clear();
+
+  size_t size() const { return _prefixes.size(); }
+  bool empty() const { return _prefixes.empty(); }
+
+  // returns the number of strings that fit without reallocating
+  size_t capacity() const { return _prefixes.capacity(); }
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // compares the string at index with value and returns a negative number, zero, or a positive number, like
+  // std::string::compare. value_prefix must be make_prefix(value).
+  int compare(const size_t index, const std::string_view value, const uint32_t value_prefix) const {
+    const auto prefix = _prefixes[index];
+    if (prefix != value_prefix) return prefix < value_prefix ? -1 : 1;
+    return (*this)[index].compare(value);
+  }
+
+  uint32_t prefix(const size_t index) const { return _prefixes[index]; }
+
+  // returns the first four characters of string as a big-endian integer, padded with zeros
+  static uint32_t make_prefix(const std::string_view string);
+
+  // returns the number of bytes allocated for the buffers, including unused capacity and retired character buffers
+  size_t allocated_bytes() const;
+
+  PolymorphicAllocator<char> get_allocator() const { return _chars.get_allocator(); }
+
+  // the characters of the first string_count strings, back to back, e.g., for exporting them
+  std::string_view chars(const size_t string_count) const {
+    return std::string_view{_char_data.load(std::memory_order_acquire), string_count == 0 ? 0 : _offsets[string_count]};
+  }
+
+  // the underlying buffers, e.g., for exporting them
+  const pmr_vector<size_t>& offsets() const { return _offsets; }
+  const pmr_vector<uint32_t>& prefixes() const { return _prefixes; }
+
+ private:
+  // makes sure that char_count characters in total fit into the character buffer, for string_count strings in total
+  void _ensure_char_capacity(const size_t string_count, const size_t char_count);
+
+  // replaces the character buffer by a copy with the given capacity and retires the previous one
+  void _replace_chars(const size_t capacity);
+
+  pmr_vector<char> _chars;
+  // the buffers that _chars has replaced, which concurrent readers may still refer to
+  std::vector<pmr_vector<char>> _retired_chars;
+  // the data of _chars, which readers access without touching _chars itself
+  std::atomic<const char*> _char_data{nullptr};
+  // string i occupies [_offsets[i], _offsets[i + 1]) of _chars. Empty vectors may have no offsets at all, so that a
+  // moved-from StringVector is empty, too.
+  pmr_vector<size_t> _offsets;
+  pmr_vector<uint32_t> _prefixes;
+};
+
+// Random access iterator over the strings of a StringVector, which returns them as std::string_views
+class StringVector::Iterator
+    : public boost::iterator_facade<Iterator, std::string_view, boost::random_access_traversal_tag, std::string_view> {
+ public:
+  Iterator() = default;
+  Iterator(const StringVector* strings, const size_t index) : _strings{strings}, _index{index} {}
+
+ private:
+  friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+  void increment() { ++_index; }
+  void decrement() { --_index; }
+  void advance(std::ptrdiff_t n) { _index += n; }
+  bool equal(const Iterator& other) const { return _index == other._index; }
+  std::ptrdiff_t distance_to(const Iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+  }
+  std::string_view dereference() const { return (*_strings)[_index]; }
+
+  const StringVector* _strings = nullptr;
+  size_t _index = 0;
+};
+
+}  // namespace opossum
@@ -4,56 +4,339 @@
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "chunk_statistics.hpp"
+#include "dictionary_column.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Table::add_column_definition(const std::string& name, const std::string& type) {
+void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
   _col_names.push_back(name);
   _col_types.push_back(type);
+  _col_nullable.push_back(nullable);
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
-  add_column_definition(name, type);
+void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+  add_column_definition(name, type, nullable);
+  const auto column_id = ColumnID{static_cast<ColumnID::base_type>(_col_types.size() - 1)};
   for (auto& chunk : _chunks) {
-    chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
+    // only the last chunk can receive further inserts, so there is no point in reserving memory for the others
+    const auto capacity = chunk == _chunks.back() ? static_cast<size_t>(_chunk_size) : size_t{0};
+    chunk->add_column(_create_value_column(column_id, *chunk, capacity));
   }
 }
 
-void Table::append(std::vector<AllTypeVariant> values) {
-  if (_chunks.back().size() >= _chunk_size && _chunk_size != 0) {
-    create_new_chunk();
+void Table::append(const std::vector<AllTypeVariant>& values) {
+  std::shared_ptr<Chunk> completed_chunk;
+  {
+    std::lock_guard<std::mutex> lock(*_append_mutex);
+    if (_is_last_chunk_complete()) {
+      completed_chunk = _create_new_chunk(_make_value_chunk());
+    }
+    _chunks.back()->append(values);
   }
-  _chunks.back().append(values);
+  _compute_statistics(completed_chunk);
+}
+
+void Table::append_columns(const std::vector<std::shared_ptr<BaseColumn>>& columns) {
+  Assert(columns.size() == _col_types.size(), "Number of columns does not match the table's column count");
+  if (columns.empty()) return;
+
+  const auto row_count = columns.front()->size();
+  for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+    Assert(columns[column_id]->size() == row_count, "All columns have to have the same size");
+    resolve_data_type(_col_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto column = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(columns[column_id]);
+      Assert(column,
+             "Column " + std::to_string(column_id) + " is not a value column of type " + _col_types[column_id]);
+      Assert(_col_nullable[column_id] || !column->is_nullable() || column->null_values().null_count() == 0,
+             "Column " + std::to_string(column_id) + " is not nullable");
+    });
+  }
+
+  std::unique_lock<std::mutex> lock(*_append_mutex);
+  std::vector<std::shared_ptr<Chunk>> completed_chunks;
+  size_t offset = 0;
+  while (offset < row_count) {
+    // a new chunk is filled before it becomes visible, so that it can take over the buffers of the columns
+    auto new_chunk = _is_last_chunk_complete() ? _make_value_chunk() : nullptr;
+    auto& chunk = new_chunk ? *new_chunk : *_chunks.back();
+    const auto free_rows = _chunk_size == 0 ? row_count : static_cast<size_t>(_chunk_size - chunk.size());
+    const auto count = std::min(row_count - offset, free_rows);
+
+    for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+      resolve_data_type(_col_types[column_id], [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        const auto source = std::static_pointer_cast<ValueColumn<ColumnDataType>>(columns[column_id]);
+        auto& source_values = source->values();
+        const auto target = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(chunk.get_column(column_id));
+        DebugAssert(static_cast<bool>(target), "Only value columns can be appended to");
+        auto& target_values = target->values();
+
+        if (target->is_nullable()) {
+          if (source->is_nullable()) {
+            target->null_values().append(source->null_values(), offset, count);
+          } else {
+            target->null_values().append_non_null(count);
+          }
+        }
+
+        if (new_chunk && offset == 0 && count == source_values.size() && source_values.capacity() >= _chunk_size &&
+            source_values.get_allocator() == target_values.get_allocator()) {
+          // everything fits into a chunk that nobody reads yet, so we can take over the whole buffer
+          // (as long as it is large enough to not be reallocated by later inserts and lives in the chunk's memory)
+          target_values = std::move(source_values);
+        } else if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+          target_values.append(source_values, offset, count);
+        } else {
+          target_values.reserve(target_values.size() + count);
+          const auto first = source_values.begin() + offset;
+          target_values.insert(target_values.end(), std::make_move_iterator(first),
+                               std::make_move_iterator(first + count));
+        }
+      });
+    }
+    chunk.publish_appended_rows();
+    if (new_chunk) {
+      if (auto completed_chunk = _create_new_chunk(new_chunk)) completed_chunks.push_back(std::move(completed_chunk));
+    }
+    offset += count;
+  }
+  lock.unlock();
+
+  for (const auto& completed_chunk : completed_chunks) {
+    _compute_statistics(completed_chunk);
+  }
+
+  // the moved-from values are of no use anymore
+  for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+    resolve_data_type(_col_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto column = std::static_pointer_cast<ValueColumn<ColumnDataType>>(columns[column_id]);
+      column->values().clear();
+      if (column->is_nullable()) column->null_values().clear();
+    });
+  }
+}
+
+void Table::emplace_chunk(std::shared_ptr<Chunk> chunk) {
+  std::unique_lock<std::mutex> lock(*_append_mutex);
+  Assert(chunk->col_count() == col_count(), "Number of columns of the chunk does not match the table's column count");
+  Assert(_chunk_size == 0 || chunk->size() <= _chunk_size, "Chunk is larger than the table's chunk size");
+  for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+    resolve_data_type(_col_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto& column = *chunk->get_column(column_id);
+      const auto matches_type = dynamic_cast<const ValueColumn<ColumnDataType>*>(&column) ||
+                                dynamic_cast<const DictionaryColumn<ColumnDataType>*>(&column);
+      Assert(matches_type,
+             "Column " + std::to_string(column_id) + " of the chunk is not of type " + _col_types[column_id]);
+    });
+  }
+
+  chunk->mark_immutable();
+  if (!chunk->statistics()) chunk->set_statistics(compute_chunk_statistics(*chunk, _col_types));
+
+  if (_chunks.back()->size() == 0) {
+    std::unique_lock<std::shared_mutex> chunks_lock(*_chunks_mutex);
+    _chunks.back() = chunk;
+    return;
+  }
+
+  // the previous chunk does not receive further inserts and is completed like a full one
+  const auto completed_chunk = _create_new_chunk(chunk);
+  lock.unlock();
+  _compute_statistics(completed_chunk);
 }
 
 void Table::create_new_chunk() {
-  _chunks.push_back(Chunk());
-  for (const auto& type : _col_types) {
-    _chunks.back().add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
+  std::shared_ptr<Chunk> completed_chunk;
+  {
+    std::lock_guard<std::mutex> lock(*_append_mutex);
+    completed_chunk = _create_new_chunk(_make_value_chunk());
+  }
+  _compute_statistics(completed_chunk);
+}
+
+std::shared_ptr<Chunk> Table::_create_new_chunk(std::shared_ptr<Chunk> new_chunk) {
+  // the previous chunk does not receive any further inserts
+  auto previous_chunk = _chunks.back();
+  const auto was_immutable = previous_chunk->is_immutable();
+  previous_chunk->mark_immutable();
+
+  {
+    std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+    _chunks.push_back(new_chunk);
+  }
+
+  // empty chunks need no statistics, emplaced and compressed chunks already have them
+  if (was_immutable || previous_chunk->size() == 0) return nullptr;
+
+  if (_compress_full_chunks) {
+    // it can be encoded (which computes the statistics as well) without blocking the ingest. The background worker
+    // runs outside of the scheduler, so the columns are encoded one after another.
+    _compression_worker->schedule([previous_chunk, column_types = _col_types]() {
+      _compress_chunk(*previous_chunk, column_types, false);
+    });
+    return nullptr;
+  }
+  return previous_chunk;
+}
+
+void Table::_compute_statistics(const std::shared_ptr<Chunk>& chunk) const {
+  if (!chunk) return;
+  chunk->set_statistics(compute_chunk_statistics(*chunk, _col_types));
+}
+
+bool Table::_is_last_chunk_complete() const {
+  const auto& last_chunk = *_chunks.back();
+  // emplaced and compressed chunks are immutable even if they are not full
+  return (_chunk_size != 0 && last_chunk.size() >= _chunk_size) || last_chunk.is_immutable();
+}
+
+std::shared_ptr<Chunk> Table::_make_chunk() const {
+  const auto alloc = PolymorphicAllocator<Chunk>{_memory_resource};
+  return std::allocate_shared<Chunk>(alloc, alloc);
+}
+
+std::shared_ptr<Chunk> Table::_make_value_chunk() const {
+  auto chunk = _make_chunk();
+  for (ColumnID column_id{0}; column_id < _col_types.size(); ++column_id) {
+    chunk->add_column(_create_value_column(column_id, *chunk, static_cast<size_t>(_chunk_size)));
+  }
+  return chunk;
+}
+
+std::shared_ptr<BaseColumn> Table::_create_value_column(const ColumnID column_id, const Chunk& chunk,
+                                                        const size_t capacity) const {
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(_col_types[column_id], [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto alloc = PolymorphicAllocator<ColumnDataType>{chunk.get_allocator()};
+    column = std::allocate_shared<ValueColumn<ColumnDataType>>(alloc, capacity,
+                                                               static_cast<bool>(_col_nullable[column_id]), alloc);
+  });
+  return column;
+}
+
+void Table::compress_chunk(ChunkID chunk_id) {
+  auto& chunk = get_chunk(chunk_id);
+  Assert(chunk_id + 1u < chunk_count() || (_chunk_size != 0 && chunk.size() >= _chunk_size),
+         "Only chunks that do not receive inserts anymore can be compressed");
+  chunk.mark_immutable();
+  _compress_chunk(chunk, _col_types, true);
+}
+
+void Table::wait_for_compression() {
+  if (_compression_worker) _compression_worker->wait();
+}
+
+size_t Table::estimate_memory_usage() const {
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+  auto bytes = sizeof(*this) + _chunks.capacity() * sizeof(std::shared_ptr<Chunk>);
+  for (const auto& chunk : _chunks) {
+    bytes += chunk->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+size_t Table::estimate_memory_usage(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+  size_t bytes = 0;
+  for (const auto& chunk : _chunks) {
+    // the initial chunk of a table whose columns were only defined (see add_column_definition) has no columns
+    if (column_id < chunk->col_count()) bytes += chunk->get_column(column_id)->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+std::shared_ptr<TableStatistics> Table::table_statistics() const {
+  std::shared_ptr<TableStatistics> table_statistics;
+  {
+    std::lock_guard<std::mutex> lock(*_append_mutex);
+    // statistics that were created before a column was added cannot be extended, so they are recreated
+    if (!_table_statistics || _table_statistics->column_count() != col_count()) {
+      _table_statistics = std::make_shared<TableStatistics>(*this);
+    }
+    table_statistics = _table_statistics;
   }
+  table_statistics->update(*this);
+  return table_statistics;
+}
+
+void Table::_compress_chunk(Chunk& chunk, const std::vector<std::string>& column_types, const bool use_scheduler) {
+  const auto col_count = std::min(static_cast<size_t>(chunk.col_count()), column_types.size());
+  std::vector<std::shared_ptr<BaseColumn>> compressed_columns(col_count);
+
+  const auto compress_column = [&](const ColumnID column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto column = chunk.get_column(column_id);
+      if (std::dynamic_pointer_cast<DictionaryColumn<ColumnDataType>>(column)) return;
+      const auto alloc = PolymorphicAllocator<ColumnDataType>{chunk.get_allocator()};
+      compressed_columns[column_id] = std::allocate_shared<DictionaryColumn<ColumnDataType>>(alloc, column, alloc);
+    });
+  };
+
+  // exceptions, e.g., if the chunk's memory resource is exhausted, are rethrown. The chunk is left uncompressed then.
+  if (use_scheduler) {
+    // every column is encoded by its own job, which runs in parallel if a scheduler is set
+    std::vector<std::shared_ptr<JobTask>> jobs;
+    jobs.reserve(col_count);
+    for (ColumnID column_id{0}; column_id < col_count; ++column_id) {
+      jobs.push_back(std::make_shared<JobTask>([&, column_id]() { compress_column(column_id); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  } else {
+    for (ColumnID column_id{0}; column_id < col_count; ++column_id) {
+      compress_column(column_id);
+    }
+  }
+
+  // swap in the encoded columns only after all of them are done so that the chunk is not half-compressed for long
+  for (ColumnID column_id{0}; column_id < col_count; ++column_id) {
+    if (!compressed_columns[column_id]) continue;
+    chunk.replace_column(column_id, compressed_columns[column_id]);
+  }
+
+  // reading min, max, and distinct count from the dictionaries is cheap
+  chunk.set_statistics(compute_chunk_statistics(chunk, column_types));
 }
 
 uint16_t Table::col_count() const { return static_cast<uint16_t>(_col_names.size()); }
 
 uint64_t Table::row_count() const {
   uint64_t row_count = 0;
-  for (auto& chunk : _chunks) {
-    row_count += chunk.size();
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (const auto& chunk : _chunks) {
+    row_count += chunk->size();
   }
   return row_count;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID{static_cast<ChunkID>(_chunks.size())}; }
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID{static_cast<ChunkID>(_chunks.size())};
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   for (size_t i = 0; i < _col_names.size(); ++i) {
@@ -66,6 +349,8 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 
 uint32_t Table::chunk_size() const { return _chunk_size; }
 
+std::pmr::memory_resource* Table::memory_resource() const { return _memory_resource; }
+
 const std::vector<std::string>& Table::column_names() const { return _col_names; }
 
 const std::string& Table::column_name(ColumnID column_id) const {
@@ -82,11 +367,19 @@ const std::string& Table::column_type(ColumnID column_id) const {
   return _col_types.at(column_id);
 }
 
+bool Table::column_is_nullable(ColumnID column_id) const {
+  if (_col_nullable.size() <= static_cast<size_t>(column_id)) {
+    throw std::runtime_error("Column not found");
+  }
+  return _col_nullable[column_id];
+}
+
 Chunk& Table::get_chunk(ChunkID chunk_id) {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
   if (_chunks.size() <= static_cast<size_t>(chunk_id)) {
     throw std::runtime_error("Chunk does not exist");
   }
-  return _chunks.at(chunk_id);
+  return *_chunks.at(chunk_id);
 }
 
 const Chunk& Table::get_chunk(ChunkID chunk_id) const { return const_cast<Table*>(this)->get_chunk(chunk_id); }
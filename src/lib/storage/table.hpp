@@ -1,8 +1,10 @@
 #pragma once
 
+#include <memory_resource>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,6 +12,7 @@
 #include "base_column.hpp"
 #include "chunk.hpp"
 
+#include "scheduler/background_worker.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -19,14 +22,33 @@ namespace opossum {
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
+//
+// Inserts (append, append_columns) may be issued by many threads concurrently. Writers are serialized by the
+// table's append mutex, which also covers the creation of new chunks. Readers do not take the append mutex; they
+// only see rows that have been completely written (see Chunk::size()). Schema changes (add_column) must not run
+// concurrently to inserts.
 class Table : private Noncopyable {
  public:
   // creates a table
-  // the parameter specifies the maximum chunk size, i.e., partition size
+  // the first parameter specifies the maximum chunk size, i.e., partition size
   // default (0) is an unlimited size. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = 0) {
-    _chunk_size = chunk_size;
-    _chunks.push_back(Chunk());
+  // every chunk that is superseded by a new one gets statistics (see Chunk::statistics)
+  // if compress_full_chunks is set, every chunk that is superseded by a new one
+  // is compressed in the background (see compress_chunk), one after another by a single thread of the table
+  // the chunks and their columns are allocated from memory_resource, e.g., an arena that is released as a whole once
+  // the table is dropped. The table does not own the resource, which has to outlive the table and every column that
+  // was taken from it. Columns are created and compressed by several threads, so the resource has to be thread-safe
+  // (like std::pmr::synchronized_pool_resource) unless the table is only used by a single thread and does not
+  // compress chunks. Chunks that are emplaced (see emplace_chunk) keep their own memory.
+  explicit Table(const uint32_t chunk_size = 0, const bool compress_full_chunks = false,
+                 std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource())
+      : _chunk_size{chunk_size},
+        _compress_full_chunks{compress_full_chunks},
+        _memory_resource{memory_resource},
+        _compression_worker{compress_full_chunks ? std::make_unique<BackgroundWorker>() : nullptr},
+        _append_mutex{std::make_unique<std::mutex>()},
+        _chunks_mutex{std::make_unique<std::shared_mutex>()} {
+    _chunks.push_back(_make_chunk());
   }
 
   // we need to explicitly set the move constructor to default when
@@ -58,6 +80,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // returns whether the nth column may contain NULLs
+  bool column_is_nullable(ColumnID column_id) const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -66,26 +91,108 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t chunk_size() const;
 
+  // returns the memory resource from which the table's chunks are allocated
+  std::pmr::memory_resource* memory_resource() const;
+
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
-  void add_column_definition(const std::string& name, const std::string& type);
+  void add_column_definition(const std::string& name, const std::string& type, const bool nullable = false);
 
   // adds a column to the end, i.e., right, of the table
   // the added column should have the same length as existing columns (if any)
-  void add_column(const std::string& name, const std::string& type);
+  // only nullable columns can hold NULLs, all others do not spend any memory on them
+  void add_column(const std::string& name, const std::string& type, const bool nullable = false);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
-  void append(std::vector<AllTypeVariant> values);
+  // note this is slow and should be used for testing purposes only
+  void append(const std::vector<AllTypeVariant>& values);
+
+  // inserts many rows at the end of the table, given column by column.
+  // there has to be one ValueColumn per column of the table, matching its type, and all of them must have the same
+  // size. The rows are distributed over as many chunks as needed. Values are moved out of the given columns without
+  // any AllTypeVariant conversions, so the given columns are empty afterwards. Columns that are given for columns of
+  // the table that are not nullable must not contain NULLs.
+  void append_columns(const std::vector<std::shared_ptr<BaseColumn>>& columns);
+
+  // adds a chunk that has been built elsewhere, e.g., by an importer. Its columns have to be value or dictionary
+  // columns of the table's column types. The chunk is marked as immutable (see Chunk::mark_immutable) and gets
+  // statistics, further inserts go to a new chunk. If the last chunk of the table is empty (e.g., the one the table is
+  // created with), it is replaced. Otherwise, the last chunk is completed just like a full one. Like add_column, this
+  // must not run concurrently to other operations on the table
+  void emplace_chunk(std::shared_ptr<Chunk> chunk);
 
   // creates a new chunk and appends it
+  // its columns reserve memory for chunk_size() values up front, so that they are never reallocated (and thus never
+  // copied or moved under concurrent readers) while the chunk fills up. The characters of strings do not fit into a
+  // reservation, so string columns keep the buffers they outgrow instead (see StringVector)
   void create_new_chunk();
 
+  // replaces all columns of the given chunk by dictionary-encoded columns and updates its statistics.
+  // every column is encoded by a job of its own (run in parallel if a scheduler is set, see CurrentScheduler) and the
+  // encoded columns are swapped in atomically so that concurrent readers are not affected. If encoding any column
+  // fails, the exception is rethrown and the chunk stays as it is.
+  // only chunks that no longer receive inserts, i.e., full chunks or chunks followed by another one, can be compressed.
+  // the chunk is marked as immutable, so that a full last chunk is not appended to afterwards
+  void compress_chunk(ChunkID chunk_id);
+
+  // blocks until all chunks that are compressed in the background have been compressed
+  // and rethrows the first exception that occurred during their compression
+  void wait_for_compression();
+
+  // returns an estimate of the number of bytes that the table's chunks occupy (see Chunk::estimate_memory_usage).
+  // it waits for running inserts to complete
+  size_t estimate_memory_usage() const;
+
+  // same as above, for the columns of a single column of the table across all chunks
+  size_t estimate_memory_usage(const ColumnID column_id) const;
+
+  // returns the statistics of the table (see TableStatistics), which are created on first access.
+  // every call brings them up to date with the rows that have been appended in the meantime
+  std::shared_ptr<TableStatistics> table_statistics() const;
+
  private:
+  // appends the given chunk, which the caller may have filled before, and completes the previous one. Expects the
+  // caller to hold the append mutex. Returns the previous chunk if its statistics still have to be computed, which the
+  // caller does after releasing the append mutex (see _compute_statistics) so that scanning the chunk does not block
+  // other inserts
+  std::shared_ptr<Chunk> _create_new_chunk(std::shared_ptr<Chunk> new_chunk);
+
+  // computes the statistics of a chunk that does not receive inserts anymore, does nothing for nullptr
+  void _compute_statistics(const std::shared_ptr<Chunk>& chunk) const;
+
+  // returns whether inserts have to go to a new chunk, expects the caller to hold the append mutex
+  bool _is_last_chunk_complete() const;
+
+  // creates an empty chunk in the table's memory resource
+  std::shared_ptr<Chunk> _make_chunk() const;
+
+  // creates an empty chunk with a value column per column of the table, reserved for _chunk_size rows
+  std::shared_ptr<Chunk> _make_value_chunk() const;
+
+  // creates an empty value column of the given column with the given capacity, allocated by the chunk it belongs to
+  std::shared_ptr<BaseColumn> _create_value_column(const ColumnID column_id, const Chunk& chunk,
+                                                   const size_t capacity) const;
+
+  // the dictionary-encoded columns are allocated by the chunk, like its value columns
+  // if use_scheduler is set, the columns are encoded by jobs of the current scheduler, otherwise by the calling thread
+  static void _compress_chunk(Chunk& chunk, const std::vector<std::string>& column_types, const bool use_scheduler);
+
   std::vector<std::string> _col_names;
   std::vector<std::string> _col_types;
-  std::vector<Chunk> _chunks;
+  std::vector<bool> _col_nullable;
+  std::vector<std::shared_ptr<Chunk>> _chunks;
   uint32_t _chunk_size;
+  bool _compress_full_chunks;
+  std::pmr::memory_resource* _memory_resource;
+  // compresses full chunks if _compress_full_chunks is set. Chunks that are still queued when the table is destroyed
+  // are not compressed anymore
+  std::unique_ptr<BackgroundWorker> _compression_worker;
+  mutable std::shared_ptr<TableStatistics> _table_statistics;
+
+  // held in unique_ptrs so that the table stays movable
+  // _append_mutex serializes writers, _chunks_mutex protects _chunks against reallocation while it is read
+  std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::shared_mutex> _chunks_mutex;
 };
 }  // namespace opossum
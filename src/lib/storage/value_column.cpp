@@ -4,6 +4,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -13,15 +14,57 @@
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(const size_t capacity, const bool nullable, const PolymorphicAllocator<T>& alloc)
+    : _entries(alloc) {
+  _entries.reserve(capacity);
+  if (nullable) {
+    _null_values.emplace(PolymorphicAllocator<uint64_t>{alloc});
+    _null_values->reserve(capacity);
+  }
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(ValueVector<T>&& values) : _entries(std::move(values)) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(const std::vector<T>& values, const PolymorphicAllocator<T>& alloc) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    _entries = StringVector{values, alloc};
+  } else {
+    _entries = ValueVector<T>(values.cbegin(), values.cend(), alloc);
+  }
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(ValueVector<T>&& values, NullBitmap&& null_values)
+    : _entries(std::move(values)), _null_values{std::move(null_values)} {
+  Assert(_entries.size() == _null_values->size(), "Null bitmap does not match the number of values");
+}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
-  return _entries.at(i);
+  if (is_null(i)) return NULL_VALUE;
+  return T{_entries.at(i)};
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
-  _entries.push_back(type_cast<T>(val));
+  const auto is_null = variant_is_null(val);
+  if (is_null && !_null_values) Fail("NULL cannot be appended to a column that is not nullable");
+
+  // the cast can fail, so it happens before anything is written to the column
+  auto value = is_null ? T{} : type_cast<T>(val);
+  if (_null_values) _null_values->push_back(is_null);
+  _entries.push_back(std::move(value));
+}
+
+template <typename T>
+AllTypeVariant ValueColumn<T>::cast_value(const AllTypeVariant& val) const {
+  if (!variant_is_null(val)) return type_cast<T>(val);
+  if (!_null_values) Fail("NULL cannot be appended to a column that is not nullable");
+  return NULL_VALUE;
 }
 
 template <typename T>
@@ -29,6 +72,50 @@ size_t ValueColumn<T>::size() const {
   return _entries.size();
 }
 
+template <typename T>
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  if constexpr (std::is_same<T, std::string>::value) {
+    bytes += _entries.allocated_bytes();
+  } else {
+    bytes += _entries.capacity() * sizeof(T);
+  }
+  if (_null_values) bytes += _null_values->allocated_bytes();
+  return bytes;
+}
+
+template <typename T>
+const ValueVector<T>& ValueColumn<T>::values() const {
+  return _entries;
+}
+
+template <typename T>
+ValueVector<T>& ValueColumn<T>::values() {
+  return _entries;
+}
+
+template <typename T>
+bool ValueColumn<T>::is_nullable() const {
+  return _null_values.has_value();
+}
+
+template <typename T>
+bool ValueColumn<T>::is_null(const size_t i) const {
+  return _null_values && _null_values->is_null(i);
+}
+
+template <typename T>
+const NullBitmap& ValueColumn<T>::null_values() const {
+  DebugAssert(_null_values.has_value(), "Column is not nullable");
+  return *_null_values;
+}
+
+template <typename T>
+NullBitmap& ValueColumn<T>::null_values() {
+  DebugAssert(_null_values.has_value(), "Column is not nullable");
+  return *_null_values;
+}
+
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
 
 }  // namespace opossum
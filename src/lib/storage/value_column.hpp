@@ -1,29 +1,77 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
+#include "null_bitmap.hpp"
+#include "string_vector.hpp"
 
 namespace opossum {
 
-// ValueColumn is a specific column type that stores all its values in a vector
+// The container in which a ValueColumn<T> stores its values. Strings are kept contiguously in a StringVector, so that
+// they do not need an allocation each. Its elements are std::string_views instead of std::strings.
+template <typename T>
+using ValueVector = std::conditional_t<std::is_same<T, std::string>::value, StringVector, pmr_vector<T>>;
+
+// ValueColumn is a specific column type that stores all its values in a vector (see ValueVector)
+// Nullable value columns additionally keep a NullBitmap. The values at NULL positions are default-constructed and must
+// be ignored. Columns that are not nullable have no null bitmap at all.
+// Values and null bitmap are allocated by the allocator that is passed on construction (see Table for placing the
+// columns of a table in a memory resource of its own).
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
+  ValueColumn() = default;
+
+  // creates an empty value column that can hold capacity values without reallocating
+  explicit ValueColumn(const size_t capacity, const bool nullable = false, const PolymorphicAllocator<T>& alloc = {});
+
+  // creates a value column that takes over the given values without copying them
+  explicit ValueColumn(ValueVector<T>&& values);
+
+  // creates a value column that copies the given values, e.g., in tests
+  explicit ValueColumn(const std::vector<T>& values, const PolymorphicAllocator<T>& alloc = {});
+
+  // creates a nullable value column that takes over the given values and their null bitmap
+  ValueColumn(ValueVector<T>&& values, NullBitmap&& null_values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
-  // add a value to the end
+  // add a value to the end. NULL can only be added to nullable columns
   void append(const AllTypeVariant& val) override;
 
+  AllTypeVariant cast_value(const AllTypeVariant& val) const override;
+
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
+  // returns all values. This is the preferred way to access the data in operators.
+  const ValueVector<T>& values() const;
+
+  // returns all values for bulk modifications, e.g., by Table::append_columns
+  ValueVector<T>& values();
+
+  // returns whether the column can hold NULLs, i.e., whether it has a null bitmap
+  bool is_nullable() const;
+
+  // returns whether the value at a certain position is NULL
+  bool is_null(const size_t i) const;
+
+  // returns the null bitmap of a nullable column. Like values(), it is meant for operators and bulk modifications
+  const NullBitmap& null_values() const;
+  NullBitmap& null_values();
+
  private:
-  std::vector<T> _entries;
+  ValueVector<T> _entries;
+  std::optional<NullBitmap> _null_values;
 };
 
 }  // namespace opossum
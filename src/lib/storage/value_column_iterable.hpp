@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "column_iterables.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueColumnIterable : public ColumnIterable<ValueColumnIterable<T>> {
+ public:
+  explicit ValueColumnIterable(const ValueColumn<T>& column)
+      : ValueColumnIterable{column, static_cast<ChunkOffset>(column.size())} {}
+
+  // iterates over the first size values only (see create_iterable_from_column)
+  ValueColumnIterable(const ValueColumn<T>& column, const ChunkOffset size) : _column{column}, _size{size} {}
+
+ private:
+  friend class ColumnIterable<ValueColumnIterable<T>>;
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    const auto& values = _column.values();
+    const auto null_values = _column.is_nullable() ? &_column.null_values() : nullptr;
+    const auto begin = values.cbegin();
+    functor(Iterator{begin, null_values, ChunkOffset{0}},
+            Iterator{begin + static_cast<std::ptrdiff_t>(_size), null_values, _size});
+  }
+
+  const ValueColumn<T>& _column;
+  const ChunkOffset _size;
+
+  class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
+   public:
+    using ValueIterator = typename ValueVector<T>::const_iterator;
+
+    // null_values is nullptr if the column is not nullable
+    Iterator(const ValueIterator value_it, const NullBitmap* null_values, const ChunkOffset chunk_offset)
+        : _value_it{value_it}, _null_values{null_values}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_value_it;
+      ++_chunk_offset;
+    }
+
+    void decrement() {
+      --_value_it;
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _value_it += n;
+      _chunk_offset += n;
+    }
+
+    bool equal(const Iterator& other) const { return _value_it == other._value_it; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const { return other._value_it - _value_it; }
+
+    ColumnIteratorValue<T> dereference() const {
+      const auto is_null = _null_values && _null_values->is_null(_chunk_offset);
+      return ColumnIteratorValue<T>{*_value_it, is_null, _chunk_offset};
+    }
+
+   private:
+    ValueIterator _value_it;
+    const NullBitmap* _null_values;
+    ChunkOffset _chunk_offset;
+  };
+};
+
+}  // namespace opossum
@@ -4,6 +4,8 @@
 
 namespace opossum {
 
-std::string to_string(const AllTypeVariant& x) { return boost::lexical_cast<std::string>(x); }
+std::string to_string(const AllTypeVariant& value) {
+  return variant_is_null(value) ? "NULL" : type_cast<std::string>(value);
+}
 
 }  // namespace opossum
@@ -5,11 +5,17 @@
 #include <boost/hana/not_equal.hpp>
 #include <boost/hana/size.hpp>
 #include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
 
+#include <charconv>
+#include <limits>
 #include <string>
+#include <system_error>
+#include <type_traits>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -24,6 +30,79 @@ constexpr auto index_of(Sequence const& sequence, T const& element) {
   return decltype(size)::value;
 }
 
+// Returns the index of type T in AllTypeVariant, which holds NullValue in front of all column types
+template <typename T>
+constexpr auto variant_index_of() {
+  return index_of(types, hana::type_c<T>) + 1;
+}
+
+// Parses the whole string as a number. Returns false instead of throwing if it is not one, as std::from_chars does.
+template <typename T>
+bool parse_number(const std::string& string, T& number) {
+  const auto* begin = string.data();
+  const auto* const end = begin + string.size();
+  // from_chars does not accept an explicit plus sign
+  if (begin != end && *begin == '+' && begin + 1 != end && begin[1] != '-') ++begin;
+
+  const auto result = std::from_chars(begin, end, number);
+  return result.ec == std::errc{} && result.ptr == end;
+}
+
+// Casts between the numerical column types. Values that T cannot represent are rejected, fractions are truncated.
+template <typename T, typename Source>
+T cast_number(const Source& value) {
+  if constexpr (std::is_integral_v<T> && std::is_floating_point_v<Source>) {
+    // both bounds are powers of two, so they are exact in every floating point type. NaN fails both comparisons.
+    constexpr auto lower_bound = static_cast<Source>(std::numeric_limits<T>::min());
+    if (!(value >= lower_bound && value < -lower_bound)) Fail("Value is out of range for the requested type");
+  } else if constexpr (std::is_integral_v<T> && sizeof(Source) > sizeof(T)) {
+    if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+      Fail("Value is out of range for the requested type");
+    }
+  }
+  return static_cast<T>(value);
+}
+
+// Converts the alternative held by an AllTypeVariant to T. Numbers are converted with static_casts, strings with
+// std::from_chars and std::to_chars, so that successful conversions neither allocate streams nor throw.
+template <typename T>
+struct TypeCastVisitor : boost::static_visitor<T> {
+  T operator()(const NullValue&) const {
+    Fail("NULL cannot be cast to a value");
+    return T{};
+  }
+
+  T operator()(const std::string& value) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return value;
+    } else {
+      auto number = T{};
+      if (parse_number(value, number)) return number;
+
+      // like SQL, allow integers to be given as decimals, e.g., "3.0"
+      if constexpr (std::is_integral_v<T>) {
+        auto decimal = double{};
+        if (parse_number(value, decimal)) return cast_number<T>(decimal);
+      }
+
+      Fail("'" + value + "' cannot be converted to the requested type");
+      return T{};
+    }
+  }
+
+  template <typename Source>
+  T operator()(const Source& value) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // the shortest representation that parses back to the same value, which fits in 32 chars for all column types
+      char buffer[32];
+      const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+      return std::string(buffer, result.ptr);
+    } else {
+      return cast_number<T>(value);
+    }
+  }
+};
+
 }  // namespace detail
 
 // Retrieves the value stored in an AllTypeVariant without conversion
@@ -33,26 +112,17 @@ const T& get(const AllTypeVariant& value) {
   return boost::get<T>(value);
 }
 
-// cast methods - from variant to specific type
-
-// Template specialization for everything but integral types
+// Casts an AllTypeVariant to T, converting the value if the variant holds another type. Throws if the value cannot be
+// represented as T, e.g., if it is NULL, a string that is not a number, or a number that is out of range.
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+T type_cast(const AllTypeVariant& value) {
+  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  if (value.which() == detail::variant_index_of<T>()) return get<T>(value);
 
-  return boost::lexical_cast<T>(value);
+  return boost::apply_visitor(detail::TypeCastVisitor<T>{}, value);
 }
 
-// Template specialization for integral types
-template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
-
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
-  }
-}
+// Returns the value as a string, and "NULL" for NULL
+std::string to_string(const AllTypeVariant& value);
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -34,9 +35,21 @@ STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 
 namespace opossum {
 
+// Storage data structures (e.g., the values of a column) take a PolymorphicAllocator, so that they can be placed in a
+// std::pmr::memory_resource of the table's choice, e.g., an arena that is released at once when the table is dropped.
+// Default-constructed allocators use std::pmr::get_default_resource(), i.e., new and delete.
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Returned by dictionary lookups (e.g., DictionaryColumn::lower_bound) if no matching value exists
+constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -53,6 +66,12 @@ struct RowID {
 
 using PosList = std::vector<RowID>;
 
+enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+
+enum class AggregateFunction { Min, Max, Sum, Avg, Count };
+
+enum class ColumnIndexType { GroupKey, AdaptiveRadixTree };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
@@ -0,0 +1,42 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Cannot open file " + filename);
+
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) == 0) _size = static_cast<size_t>(file_status.st_size);
+
+  // empty files cannot be mapped, but there is nothing to read from them anyway
+  if (_size > 0) {
+    auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (data != MAP_FAILED) {
+      _data = static_cast<const char*>(data);
+      // files are read from front to back
+      madvise(data, _size, MADV_SEQUENTIAL);
+    }
+  }
+  close(file_descriptor);
+  Assert(_data || _size == 0, "Cannot map file " + filename);
+}
+
+MappedFile::~MappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MappedFile::data() const { return _data; }
+
+size_t MappedFile::size() const { return _size; }
+
+}  // namespace opossum
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file into memory (read-only) for as long as it lives, e.g., to load a table from it (see ImportBinary)
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+ private:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace opossum {
+
+// Scrambles the bits of a hash value (finalizer of MurmurHash3).
+// std::hash is the identity for integers, while probabilistic counting (e.g., linear counting or HyperLogLog)
+// expects the bits of a hash to be uniformly distributed.
+inline uint64_t mix_hash(uint64_t hash) {
+  hash = (hash ^ (hash >> 33)) * 0xff51afd7ed558ccdull;
+  hash = (hash ^ (hash >> 33)) * 0xc4ceb9fe1a85ec53ull;
+  return hash ^ (hash >> 33);
+}
+
+}  // namespace opossum
@@ -6,6 +6,8 @@
 #include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -40,16 +42,21 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& t) {
     const Chunk& chunk = t.get_chunk(chunk_id);
 
     // an empty table's chunk might be missing actual columns
-    if (chunk.size() == 0) continue;
+    const auto chunk_size = chunk.size();
+    if (chunk_size == 0) continue;
 
     for (ColumnID col_id{0}; col_id < t.col_count(); ++col_id) {
       std::shared_ptr<BaseColumn> column = chunk.get_column(col_id);
 
-      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
-        matrix[row_offset + chunk_offset][col_id] = (*column)[chunk_offset];
-      }
+      resolve_data_and_column_type(t.column_type(col_id), *column, [&](auto type, const auto& typed_column) {
+        using ColumnDataType = typename decltype(type)::type;
+        create_iterable_from_column<ColumnDataType>(typed_column, chunk_size).for_each([&](const auto& column_value) {
+          auto& cell = matrix[row_offset + column_value.chunk_offset()][col_id];
+          cell = column_value.is_null() ? NULL_VALUE : AllTypeVariant{ColumnDataType{column_value.value()}};
+        });
+      });
     }
-    row_offset += chunk.size();
+    row_offset += chunk_size;
   }
 
   return matrix;
@@ -123,6 +130,13 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID col{0}; col < left[row].size(); col++) {
+      // NULL is not equal to anything, not even NULL, so it is compared separately
+      if (variant_is_null(left[row][col]) || variant_is_null(right[row][col])) {
+        EXPECT_TRUE(variant_is_null(left[row][col]) && variant_is_null(right[row][col]))
+            << "Row:" << row + 1 << " Col:" << col + 1;
+        continue;
+      }
+
       if (tleft.column_type(col) == "float") {
         auto left_val = type_cast<float>(left[row][col]);
         auto right_val = type_cast<float>(right[row][col]);
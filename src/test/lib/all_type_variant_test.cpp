@@ -1,4 +1,5 @@
 #include <cstdlib>
+#include <limits>
 #include <string>
 
 #include "../base_test.hpp"
@@ -42,6 +43,53 @@ TEST_F(AllTypeVariantTest, TypeCastExtractsExactValue) {
   }
 }
 
+TEST_F(AllTypeVariantTest, NullValue) {
+  EXPECT_TRUE(variant_is_null(NULL_VALUE));
+  EXPECT_TRUE(variant_is_null(AllTypeVariant{}));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{0}));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{""}));
+
+  // comparisons with NULL are never true, not even with NULL itself
+  EXPECT_FALSE(NULL_VALUE == NULL_VALUE);
+  EXPECT_FALSE(NULL_VALUE < NULL_VALUE);
+  EXPECT_EQ(type_cast<int>(AllTypeVariant{7}), 7);
+}
+
+TEST_F(AllTypeVariantTest, TypeCastConvertsBetweenTypes) {
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{-42}}), -42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.9}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-3.9f}), -3);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{7}}), 7);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{0.5}), 0.5f);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{int64_t{1} << 40}), 1099511627776.0);
+
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"123"}), 123);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"+123"}), 123);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"-12.5"}), -12);
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{"10000000000"}), 10'000'000'000);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{"1e3"}), 1000.0);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{"-0.25"}), -0.25f);
+
+  // numbers are printed with the shortest representation that reads back to the same value
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{-17}), "-17");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{123456.7}), "123456.7");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{0.1f}), "0.1");
+  EXPECT_EQ(to_string(AllTypeVariant{int64_t{5}}), "5");
+  EXPECT_EQ(to_string(NULL_VALUE), "NULL");
+}
+
+TEST_F(AllTypeVariantTest, TypeCastRejectsInvalidValues) {
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"12a"}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{""}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{" 1"}), std::exception);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{"Hi"}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 40}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{1e10}), std::exception);
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{std::numeric_limits<double>::quiet_NaN()}), std::exception);
+  EXPECT_THROW(type_cast<int32_t>(NULL_VALUE), std::exception);
+  EXPECT_THROW(type_cast<std::string>(NULL_VALUE), std::exception);
+}
+
 TEST_F(AllTypeVariantTest, GetExtractsExactNumericalValue) {
   {
     const auto value_in = static_cast<float>(std::rand()) / RAND_MAX;
@@ -0,0 +1,69 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/cast_predicate.hpp"
+
+namespace opossum {
+
+class CastPredicateTest : public BaseTest {
+ protected:
+  template <typename T>
+  void expect_predicate(const std::optional<CastPredicate<T>>& predicate, const ScanType scan_type, const T value) {
+    ASSERT_TRUE(predicate);
+    EXPECT_EQ(predicate->scan_type, scan_type);
+    EXPECT_EQ(predicate->value, value);
+  }
+};
+
+TEST_F(CastPredicateTest, ExactValuesAreKept) {
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpLessThan, 3), ScanType::OpLessThan, 3);
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpLessThan, 3.0), ScanType::OpLessThan, 3);
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpEquals, "3"), ScanType::OpEquals, 3);
+  expect_predicate(cast_predicate<double>(ScanType::OpEquals, 0.1f), ScanType::OpEquals, double{0.1f});
+  expect_predicate(cast_predicate<std::string>(ScanType::OpGreaterThan, 12), ScanType::OpGreaterThan,
+                   std::string{"12"});
+}
+
+TEST_F(CastPredicateTest, FractionsAreNotTruncated) {
+  EXPECT_FALSE(cast_predicate<int32_t>(ScanType::OpEquals, 2.5));
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpLessThan, 2.5), ScanType::OpLessThanEquals, 2);
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpLessThanEquals, "2.5"), ScanType::OpLessThanEquals, 2);
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpGreaterThanEquals, 2.5), ScanType::OpGreaterThan, 2);
+  expect_predicate(cast_predicate<int64_t>(ScanType::OpGreaterThan, -2.5), ScanType::OpGreaterThan, int64_t{-3});
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpNotEquals, 2.5), ScanType::OpGreaterThanEquals,
+                   std::numeric_limits<int32_t>::min());
+
+  // the float closest to 0.1 is greater than 0.1
+  expect_predicate(cast_predicate<float>(ScanType::OpLessThan, 0.1), ScanType::OpLessThanEquals,
+                   std::nextafter(0.1f, 0.0f));
+}
+
+TEST_F(CastPredicateTest, ValuesOutOfRange) {
+  const auto all_ints = std::numeric_limits<int32_t>::min();
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpLessThan, int64_t{5'000'000'000}),
+                   ScanType::OpGreaterThanEquals, all_ints);
+  EXPECT_FALSE(cast_predicate<int32_t>(ScanType::OpGreaterThan, int64_t{5'000'000'000}));
+  EXPECT_FALSE(cast_predicate<int32_t>(ScanType::OpEquals, -1e20));
+  expect_predicate(cast_predicate<int32_t>(ScanType::OpGreaterThan, -1e20), ScanType::OpGreaterThanEquals, all_ints);
+  expect_predicate(cast_predicate<float>(ScanType::OpGreaterThan, 1e300), ScanType::OpGreaterThan,
+                   std::numeric_limits<float>::max());
+}
+
+TEST_F(CastPredicateTest, NullAndNaN) {
+  EXPECT_FALSE(cast_predicate<int32_t>(ScanType::OpNotEquals, NULL_VALUE));
+  EXPECT_FALSE(cast_predicate<std::string>(ScanType::OpEquals, NULL_VALUE));
+  EXPECT_FALSE(cast_predicate<int32_t>(ScanType::OpLessThan, std::nan("")));
+  EXPECT_TRUE(cast_predicate<int32_t>(ScanType::OpNotEquals, std::nan("")));
+}
+
+TEST_F(CastPredicateTest, ThrowsForStringsThatAreNoNumbers) {
+  EXPECT_THROW(cast_predicate<int32_t>(ScanType::OpEquals, "abc"), std::exception);
+}
+
+}  // namespace opossum
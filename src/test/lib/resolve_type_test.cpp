@@ -0,0 +1,69 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class ResolveTypeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    value_column = std::make_shared<ValueColumn<int>>();
+    value_column->append(3);
+    value_column->append(1);
+    value_column->append(3);
+    dictionary_column = std::make_shared<DictionaryColumn<int>>(value_column);
+  }
+
+  std::shared_ptr<BaseColumn> value_column;
+  std::shared_ptr<BaseColumn> dictionary_column;
+};
+
+TEST_F(ResolveTypeTest, ResolveValueColumn) {
+  auto resolved = false;
+  resolve_column_type<int>(*value_column, [&](auto& typed_column) {
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+    if constexpr (std::is_same<ColumnType, ValueColumn<int>>::value) {
+      EXPECT_EQ(typed_column.values()[1], 1);
+      resolved = true;
+    }
+  });
+  EXPECT_TRUE(resolved);
+}
+
+TEST_F(ResolveTypeTest, ResolveConstDictionaryColumn) {
+  const BaseColumn& column = *dictionary_column;
+  auto resolved = false;
+  resolve_column_type<int>(column, [&](auto& typed_column) {
+    using ColumnType = std::remove_reference_t<decltype(typed_column)>;
+    static_assert(std::is_const<ColumnType>::value, "Constness has to be preserved");
+    if constexpr (std::is_same<std::remove_const_t<ColumnType>, DictionaryColumn<int>>::value) {
+      EXPECT_EQ(typed_column.unique_values_count(), 2u);
+      resolved = true;
+    }
+  });
+  EXPECT_TRUE(resolved);
+}
+
+TEST_F(ResolveTypeTest, ResolveDataAndColumnType) {
+  auto resolved = false;
+  resolve_data_and_column_type("int", *value_column, [&](auto type, auto& typed_column) {
+    using Type = typename decltype(type)::type;
+    EXPECT_TRUE((std::is_same<Type, int>::value));
+    EXPECT_EQ(typed_column.size(), 3u);
+    resolved = true;
+  });
+  EXPECT_TRUE(resolved);
+}
+
+TEST_F(ResolveTypeTest, ResolveWrongDataType) {
+  EXPECT_THROW(resolve_column_type<float>(*value_column, [](auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,240 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "float");
+
+    _table->append({1, "x", 1.5f});
+    _table->append({2, "y", 2.5f});
+    _table->append({1, "x", 3.5f});
+    _table->append({1, "y", 4.5f});
+    _table->append({2, "y", 5.5f});
+    _table->append({3, "x", 6.5f});
+    _table->append({1, "x", 7.5f});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAggregateTest, SingleGroupByColumn) {
+  const auto result =
+      Aggregate{_table,
+                {{ColumnID{2}, AggregateFunction::Min},
+                 {ColumnID{2}, AggregateFunction::Max},
+                 {ColumnID{2}, AggregateFunction::Sum},
+                 {ColumnID{2}, AggregateFunction::Avg},
+                 {ColumnID{2}, AggregateFunction::Count}},
+                {ColumnID{0}}}
+          .execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("MIN(c)", "float");
+  expected->add_column("MAX(c)", "float");
+  expected->add_column("SUM(c)", "double");
+  expected->add_column("AVG(c)", "double");
+  expected->add_column("COUNT(c)", "long");
+  expected->append({1, 1.5f, 7.5f, 17.0, 4.25, int64_t{4}});
+  expected->append({2, 2.5f, 5.5f, 8.0, 4.0, int64_t{2}});
+  expected->append({3, 6.5f, 6.5f, 6.5, 6.5, int64_t{1}});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, MultipleGroupByColumns) {
+  const auto result =
+      Aggregate{_table, {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{2}, AggregateFunction::Count}},
+                {ColumnID{1}, ColumnID{0}}}
+          .execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("COUNT(c)", "long");
+  expected->append({"x", 1, int64_t{3}, int64_t{3}});
+  expected->append({"y", 2, int64_t{4}, int64_t{2}});
+  expected->append({"y", 1, int64_t{1}, int64_t{1}});
+  expected->append({"x", 3, int64_t{3}, int64_t{1}});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, AggregateWithScheduler) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  const auto result =
+      Aggregate{_table, {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{2}, AggregateFunction::Max}}, {ColumnID{1}}}
+          .execute();
+  CurrentScheduler::set(nullptr);
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("SUM(a)", "long");
+  expected->add_column("MAX(c)", "float");
+  expected->append({"x", int64_t{6}, 7.5f});
+  expected->append({"y", int64_t{5}, 5.5f});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, StringMinMax) {
+  const auto result =
+      Aggregate{_table, {{ColumnID{1}, AggregateFunction::Min}, {ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}}}
+          .execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("MIN(b)", "string");
+  expected->add_column("MAX(b)", "string");
+  expected->append({1, "x", "y"});
+  expected->append({2, "y", "y"});
+  expected->append({3, "x", "x"});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupByColumns) {
+  const auto result =
+      Aggregate{_table, {{ColumnID{0}, AggregateFunction::Max}, {ColumnID{0}, AggregateFunction::Avg}}, {}}.execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("MAX(a)", "int");
+  expected->add_column("AVG(a)", "double");
+  expected->append({3, 11.0 / 7.0});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByOnly) {
+  const auto result = Aggregate{_table, {}, {ColumnID{1}}}.execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->append({"x"});
+  expected->append({"y"});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceTable) {
+  const auto scanned =
+      make_reference_table(_table, TableScan{_table, ColumnID{2}, ScanType::OpGreaterThan, 3.0f}.execute());
+  const auto result = Aggregate{scanned, {{ColumnID{2}, AggregateFunction::Count}}, {ColumnID{1}}}.execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("COUNT(c)", "long");
+  expected->append({"x", int64_t{3}});
+  expected->append({"y", int64_t{2}});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, NullValues) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  table->add_column("c", "float", true);
+  table->append({1, 1.5f});
+  table->append({NULL_VALUE, 2.5f});
+  table->append({1, NULL_VALUE});
+  table->append({2, NULL_VALUE});
+  table->append({NULL_VALUE, 5.5f});
+  table->append({1, 7.5f});
+  table->compress_chunk(ChunkID{1});
+
+  // NULLs form a group of their own, but are not aggregated. Group 2 has no values, so only its COUNT is not NULL.
+  const auto result = Aggregate{table,
+                                {{ColumnID{1}, AggregateFunction::Min},
+                                 {ColumnID{1}, AggregateFunction::Sum},
+                                 {ColumnID{1}, AggregateFunction::Avg},
+                                 {ColumnID{1}, AggregateFunction::Count}},
+                                {ColumnID{0}}}
+                          .execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int", true);
+  expected->add_column("MIN(c)", "float", true);
+  expected->add_column("SUM(c)", "double", true);
+  expected->add_column("AVG(c)", "double", true);
+  expected->add_column("COUNT(c)", "long");
+  expected->append({1, 1.5f, 9.0, 4.5, int64_t{2}});
+  expected->append({NULL_VALUE, 2.5f, 8.0, 4.0, int64_t{2}});
+  expected->append({2, NULL_VALUE, NULL_VALUE, NULL_VALUE, int64_t{0}});
+
+  EXPECT_TABLE_EQ(result, expected);
+  EXPECT_TRUE(result->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(result->column_is_nullable(ColumnID{4}));
+}
+
+TEST_F(OperatorsAggregateTest, GroupWithOnlyNullsInLaterChunk) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->add_column("c", "int", true);
+  table->append({1, 5});
+  table->append({1, 7});
+  table->append({1, NULL_VALUE});
+
+  const auto result =
+      Aggregate{table, {{ColumnID{1}, AggregateFunction::Min}, {ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}}}
+          .execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("MIN(c)", "int", true);
+  expected->add_column("MAX(c)", "int", true);
+  expected->append({1, 5, 7});
+
+  EXPECT_TABLE_EQ(result, expected);
+}
+
+TEST_F(OperatorsAggregateTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+
+  const auto result = Aggregate{table, {{ColumnID{0}, AggregateFunction::Sum}}, {ColumnID{0}}}.execute();
+  EXPECT_EQ(result->col_count(), 2u);
+  EXPECT_EQ(result->row_count(), 0u);
+}
+
+TEST_F(OperatorsAggregateTest, EmptyTableWithoutGroupBy) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+
+  // without group-by columns, the result has a single row: COUNT is 0, all other aggregates are NULL
+  const auto result =
+      Aggregate{table, {{ColumnID{0}, AggregateFunction::Sum}, {ColumnID{0}, AggregateFunction::Count}}, {}}.execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("SUM(a)", "long", true);
+  expected->add_column("COUNT(a)", "long");
+  expected->append({NULL_VALUE, int64_t{0}});
+
+  EXPECT_TABLE_EQ(result, expected);
+  EXPECT_TRUE(result->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(result->column_is_nullable(ColumnID{1}));
+}
+
+TEST_F(OperatorsAggregateTest, SumOfStrings) {
+  EXPECT_THROW(Aggregate(_table, {{ColumnID{1}, AggregateFunction::Sum}}, {}), std::exception);
+}
+
+}  // namespace opossum
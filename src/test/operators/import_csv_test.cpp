@@ -0,0 +1,144 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/import_csv.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsImportCsvTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    std::remove(_filename.c_str());
+    StorageManager::reset();
+  }
+
+  void write_file(const std::string& content) { std::ofstream{_filename, std::ios::binary} << content; }
+
+  const std::string _filename = "import_csv_test.csv";
+};
+
+TEST_F(OperatorsImportCsvTest, AllTypes) {
+  write_file(
+      "a,b,c,d,e\n"
+      "int,long,float,double,string\n"
+      "1,10000000000,1.5,0.25,hello\n"
+      "-2,-3,-4.5,1e3,\n"
+      "3,4,5,6,world\n");
+
+  const auto table = ImportCsv{_filename, "table", 2}.execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "long");
+  expected->add_column("c", "float");
+  expected->add_column("d", "double");
+  expected->add_column("e", "string");
+  expected->append({1, int64_t{10'000'000'000}, 1.5f, 0.25, "hello"});
+  expected->append({-2, int64_t{-3}, -4.5f, 1000.0, ""});
+  expected->append({3, int64_t{4}, 5.0f, 6.0, "world"});
+
+  EXPECT_TABLE_EQ(table, expected, true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(StorageManager::get().get_table("table"), table);
+}
+
+TEST_F(OperatorsImportCsvTest, QuotedFieldsAndLineEndings) {
+  write_file(
+      "\"name; quoted\";text\r\n"
+      "int;string\r\n"
+      "1;\"a;b\"\r\n"
+      "\n"
+      "2;\"say \"\"hi\"\"\"\r\n"
+      "3;\"\"");
+
+  const auto table = ImportCsv{_filename, "table", 0, ';'}.execute();
+  EXPECT_EQ(table->column_name(ColumnID{0}), "name; quoted");
+  EXPECT_EQ(table->row_count(), 3u);
+  const auto& column = *table->get_chunk(ChunkID{0}).get_column(ColumnID{1});
+  EXPECT_EQ(column[0], AllTypeVariant{"a;b"});
+  EXPECT_EQ(column[1], AllTypeVariant{"say \"hi\""});
+  EXPECT_EQ(column[2], AllTypeVariant{""});
+}
+
+TEST_F(OperatorsImportCsvTest, ManyBlocksInParallel) {
+  // several blocks of a few megabytes each
+  std::string content = "a,b\nint,string\n";
+  const auto row_count = 400'000;
+  for (auto row = 0; row < row_count; ++row) {
+    content += std::to_string(row) + ",value_" + std::to_string(row % 100) + "\n";
+  }
+  write_file(content);
+
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+  const auto table = ImportCsv{_filename, "table", 100'000}.execute();
+  CurrentScheduler::set(nullptr);
+
+  ASSERT_EQ(table->row_count(), static_cast<uint64_t>(row_count));
+  EXPECT_EQ(table->chunk_count(), 4u);
+  // rows keep the order of the file
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& column = *table->get_chunk(chunk_id).get_column(ColumnID{0});
+    EXPECT_EQ(column[0], AllTypeVariant{static_cast<int32_t>(chunk_id * 100'000)});
+    EXPECT_EQ(column[99'999], AllTypeVariant{static_cast<int32_t>(chunk_id * 100'000 + 99'999)});
+  }
+}
+
+TEST_F(OperatorsImportCsvTest, NullableColumns) {
+  write_file(
+      "a,b,c\n"
+      "int_null,string_null,string\n"
+      "1,x,\n"
+      ",\"\",y\n"
+      "3,,z\n");
+
+  const auto table = ImportCsv{_filename, "table"}.execute();
+
+  // an unquoted empty field is NULL in a nullable column, a quoted one is the empty string
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int", true);
+  expected->add_column("b", "string", true);
+  expected->add_column("c", "string");
+  expected->append({1, "x", ""});
+  expected->append({NULL_VALUE, "", "y"});
+  expected->append({3, NULL_VALUE, "z"});
+
+  EXPECT_TABLE_EQ(table, expected, true);
+  EXPECT_TRUE(table->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(table->column_is_nullable(ColumnID{2}));
+  EXPECT_EQ(table->column_type(ColumnID{1}), "string");
+}
+
+TEST_F(OperatorsImportCsvTest, InvalidFiles) {
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("a,b\nint,int\n1\n");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("a,b\nint,int\n1,2,3\n");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("a,b\nint,int\n1,x\n");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("a,b\nint,string\n1,\"open\n");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  write_file("a,b\nint,unknown_type\n1,2\n");
+  EXPECT_THROW(ImportCsv(_filename, "table").execute(), std::logic_error);
+
+  EXPECT_FALSE(StorageManager::get().has_table("table"));
+}
+
+}  // namespace opossum
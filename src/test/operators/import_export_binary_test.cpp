@@ -0,0 +1,176 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/export_binary.hpp"
+#include "../lib/operators/import_binary.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/storage/chunk_statistics.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsImportExportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+
+    for (auto i = 0; i < 10; ++i) {
+      _table->append({i % 3, int64_t{i} << 40, i * 0.5f, i * 0.25, std::string(static_cast<size_t>(i), 'x')});
+    }
+  }
+
+  void TearDown() override {
+    std::remove(_filename.c_str());
+    StorageManager::reset();
+  }
+
+  std::shared_ptr<Table> round_trip(const std::shared_ptr<const Table>& table) {
+    ExportBinary{table, _filename}.execute();
+    return ImportBinary{_filename}.execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _filename = "import_export_binary_test.bin";
+};
+
+TEST_F(OperatorsImportExportBinaryTest, ValueColumns) {
+  const auto table = round_trip(_table);
+  EXPECT_TABLE_EQ(table, _table, true);
+  EXPECT_EQ(table->chunk_size(), 4u);
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->column_name(ColumnID{4}), "e");
+  EXPECT_EQ(table->column_type(ColumnID{1}), "long");
+}
+
+TEST_F(OperatorsImportExportBinaryTest, DictionaryColumns) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+
+  const auto table = round_trip(_table);
+  EXPECT_TABLE_EQ(table, _table, true);
+  // columns stay encoded
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      table->get_chunk(ChunkID{1}).get_column(ColumnID{4})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueColumn<std::string>>(
+      table->get_chunk(ChunkID{2}).get_column(ColumnID{4})));
+}
+
+TEST_F(OperatorsImportExportBinaryTest, WideDictionaries) {
+  // more than 256 distinct values require a 2 byte attribute vector
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 1000; ++i) {
+    table->append({i * 7 % 500});
+  }
+  table->compress_chunk(ChunkID{0});
+
+  EXPECT_TABLE_EQ(round_trip(table), table, true);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, ReferenceColumns) {
+  const auto pos_list = TableScan{_table, ColumnID{0}, ScanType::OpEquals, 1}.execute();
+  const auto reference_table = make_reference_table(_table, pos_list);
+
+  const auto table = round_trip(reference_table);
+  EXPECT_TABLE_EQ(table, reference_table, true);
+  EXPECT_EQ(table->row_count(), 3u);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, ImportedChunksAreComplete) {
+  const auto table = round_trip(_table);
+
+  // the last chunk was not full, but inserts go to a new chunk nonetheless, so that its statistics stay valid
+  EXPECT_TRUE(table->get_chunk(ChunkID{2}).statistics());
+  table->append({7, int64_t{7}, 7.0f, 7.0, "seven"});
+  EXPECT_EQ(table->chunk_count(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2}).size(), 2u);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, EmptyTable) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+
+  const auto imported_table = round_trip(table);
+  EXPECT_EQ(imported_table->row_count(), 0u);
+  EXPECT_EQ(imported_table->col_count(), 1u);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, AddToStorageManager) {
+  ExportBinary{_table, _filename}.execute();
+  ImportBinary{_filename, "imported"}.execute();
+  EXPECT_TABLE_EQ(StorageManager::get().get_table("imported"), _table, true);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, NullableColumns) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int", true);
+  table->add_column("b", "string", true);
+  for (auto i = 0; i < 250; ++i) {
+    table->append({i % 7 == 0 ? NULL_VALUE : AllTypeVariant{i}, i % 5 == 0 ? NULL_VALUE : AllTypeVariant{"b"}});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  const auto imported = round_trip(table);
+  EXPECT_TABLE_EQ(imported, table, true);
+  EXPECT_TRUE(imported->column_is_nullable(ColumnID{1}));
+  const auto dict_col = std::dynamic_pointer_cast<const DictionaryColumn<int>>(
+      imported->get_chunk(ChunkID{1}).get_column(ColumnID{0}));
+  ASSERT_TRUE(dict_col);
+  EXPECT_TRUE(dict_col->is_null(5));
+  EXPECT_EQ(dict_col->unique_values_count(), 86u);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, InvalidFiles) {
+  EXPECT_THROW(ImportBinary{"this_file_does_not_exist.bin"}.execute(), std::logic_error);
+
+  std::ofstream{_filename} << "no table";
+  EXPECT_THROW(ImportBinary{_filename}.execute(), std::logic_error);
+
+  // a truncated file
+  ExportBinary{_table, _filename}.execute();
+  std::string content;
+  {
+    std::ifstream file{_filename, std::ios::binary};
+    content.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+  }
+  std::ofstream{_filename, std::ios::binary | std::ios::trunc}.write(content.data(), content.size() / 2);
+  EXPECT_THROW(ImportBinary{_filename}.execute(), std::logic_error);
+}
+
+TEST_F(OperatorsImportExportBinaryTest, InvalidValueIds) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->append({1});
+  table->append({2});
+  table->append({3});
+  table->compress_chunk(ChunkID{0});
+  ExportBinary{table, _filename}.execute();
+
+  // the file ends with the two words of the bit-packed value ids (2 bits each) of the dictionary column. The value id
+  // of the last row is set to 3, but the dictionary only has three entries.
+  std::string content;
+  {
+    std::ifstream file{_filename, std::ios::binary};
+    content.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+  }
+  content[content.size() - 2 * sizeof(uint64_t)] |= 0b110000;
+  std::ofstream{_filename, std::ios::binary | std::ios::trunc}.write(content.data(), content.size());
+  EXPECT_THROW(ImportBinary{_filename}.execute(), std::logic_error);
+}
+
+}  // namespace opossum
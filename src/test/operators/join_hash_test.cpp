@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left = std::make_shared<Table>(2);
+    _left->add_column("id", "int");
+    _left->add_column("name", "string");
+    _left->append({1, "one"});
+    _left->append({2, "two"});
+    _left->append({3, "three"});
+    _left->append({2, "zwei"});
+    _left->append({5, "five"});
+    _left->compress_chunk(ChunkID{0});
+
+    _right = std::make_shared<Table>(3);
+    _right->add_column("left_id", "int");
+    _right->add_column("value", "float");
+    for (auto i = 0; i < 8; ++i) {
+      _right->append({i % 4, static_cast<float>(i)});
+    }
+  }
+
+  // returns the matching pairs of rows, sorted so that the result does not depend on the join order
+  static std::vector<std::pair<RowID, RowID>> _pairs(
+      const std::pair<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>& result) {
+    EXPECT_EQ(result.first->size(), result.second->size());
+    std::vector<std::pair<RowID, RowID>> pairs;
+    for (size_t i = 0; i < result.first->size(); ++i) {
+      pairs.emplace_back((*result.first)[i], (*result.second)[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  }
+
+  // computes the join with nested loops
+  std::vector<std::pair<RowID, RowID>> _expected_pairs() const {
+    std::vector<std::pair<RowID, RowID>> pairs;
+    for (ChunkID left_chunk_id{0}; left_chunk_id < _left->chunk_count(); ++left_chunk_id) {
+      const auto& left_column = *_left->get_chunk(left_chunk_id).get_column(ColumnID{0});
+      for (ChunkOffset left_offset = 0; left_offset < left_column.size(); ++left_offset) {
+        for (ChunkID right_chunk_id{0}; right_chunk_id < _right->chunk_count(); ++right_chunk_id) {
+          const auto& right_column = *_right->get_chunk(right_chunk_id).get_column(ColumnID{0});
+          for (ChunkOffset right_offset = 0; right_offset < right_column.size(); ++right_offset) {
+            if (left_column[left_offset] == right_column[right_offset]) {
+              pairs.emplace_back(RowID{left_chunk_id, left_offset}, RowID{right_chunk_id, right_offset});
+            }
+          }
+        }
+      }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  }
+
+  std::shared_ptr<Table> _left;
+  std::shared_ptr<Table> _right;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinsMatchingRows) {
+  const auto result = JoinHash{_left, _right, ColumnID{0}, ColumnID{0}}.execute();
+  EXPECT_EQ(result.first->size(), 8u);
+  EXPECT_EQ(_pairs(result), _expected_pairs());
+}
+
+TEST_F(OperatorsJoinHashTest, BuildSideIsSymmetric) {
+  // the right table is larger, so swapping the inputs swaps the build side
+  const auto result = JoinHash{_right, _left, ColumnID{0}, ColumnID{0}}.execute();
+  const auto swapped = std::make_pair(result.second, result.first);
+  EXPECT_EQ(_pairs(swapped), _expected_pairs());
+}
+
+TEST_F(OperatorsJoinHashTest, RadixPartitioning) {
+  for (const auto radix_bits : {1, 2, 5}) {
+    const auto result = JoinHash{_left, _right, ColumnID{0}, ColumnID{0}, static_cast<uint8_t>(radix_bits)}.execute();
+    EXPECT_EQ(_pairs(result), _expected_pairs()) << radix_bits << " radix bits";
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, ManyRowsWithEqualLowBits) {
+  // all values are multiples of 1024, so without mixing the hashes they would all fall into the same partition
+  auto build = std::make_shared<Table>(100);
+  build->add_column("a", "long");
+  for (auto row = 0; row < 1000; ++row) build->append({int64_t{row} * 1024});
+  auto probe = std::make_shared<Table>(100);
+  probe->add_column("a", "long");
+  for (auto row = 0; row < 3000; ++row) probe->append({int64_t{row % 1500} * 1024});
+
+  for (const auto radix_bits : {0, 4}) {
+    const auto result = JoinHash{build, probe, ColumnID{0}, ColumnID{0}, static_cast<uint8_t>(radix_bits)}.execute();
+    ASSERT_EQ(result.first->size(), 2000u);
+    for (size_t index = 0; index < result.first->size(); ++index) {
+      const auto build_row = (*result.first)[index];
+      const auto probe_row = (*result.second)[index];
+      EXPECT_EQ((*build->get_chunk(build_row.chunk_id).get_column(ColumnID{0}))[build_row.chunk_offset],
+                (*probe->get_chunk(probe_row.chunk_id).get_column(ColumnID{0}))[probe_row.chunk_offset]);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStrings) {
+  auto other = std::make_shared<Table>();
+  other->add_column("name", "string");
+  other->append({"two"});
+  other->append({"five"});
+  other->append({"six"});
+
+  const auto result = JoinHash{_left, other, ColumnID{1}, ColumnID{0}}.execute();
+  EXPECT_EQ(_pairs(result), (std::vector<std::pair<RowID, RowID>>{{RowID{ChunkID{0}, 1u}, RowID{ChunkID{0}, 0u}},
+                                                                   {RowID{ChunkID{2}, 0u}, RowID{ChunkID{0}, 1u}}}));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferenceTables) {
+  const auto scanned = make_reference_table(
+      _right, TableScan{_right, ColumnID{1}, ScanType::OpGreaterThanEquals, 4.0f}.execute());
+  const auto result = JoinHash{_left, scanned, ColumnID{0}, ColumnID{0}}.execute();
+
+  // the positions of the right side refer to the scan result, which references rows 4 to 7 of the right table
+  auto expected = std::make_shared<Table>();
+  expected->add_column("left_id", "int");
+  expected->add_column("value", "float");
+  expected->append({1, 5.0f});
+  expected->append({2, 6.0f});
+  expected->append({2, 6.0f});
+  expected->append({3, 7.0f});
+  EXPECT_TABLE_EQ(make_reference_table(scanned, result.second), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, MismatchingTypes) {
+  EXPECT_THROW(JoinHash(_left, _right, ColumnID{0}, ColumnID{1}), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,218 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+
+    for (const auto value : _values) {
+      _table->append({value, std::to_string(value)});
+    }
+  }
+
+  // scans column "a" for all scan types and compares the result with a naive evaluation of the predicate
+  template <typename SearchValue>
+  void check_all_scan_types(const SearchValue search_value) {
+    check_scan(ScanType::OpEquals, search_value, std::equal_to<>{});
+    check_scan(ScanType::OpNotEquals, search_value, std::not_equal_to<>{});
+    check_scan(ScanType::OpLessThan, search_value, std::less<>{});
+    check_scan(ScanType::OpLessThanEquals, search_value, std::less_equal<>{});
+    check_scan(ScanType::OpGreaterThan, search_value, std::greater<>{});
+    check_scan(ScanType::OpGreaterThanEquals, search_value, std::greater_equal<>{});
+  }
+
+  template <typename SearchValue, typename Comparator>
+  void check_scan(const ScanType scan_type, const SearchValue search_value, const Comparator& comparator) {
+    auto expected = PosList{};
+    for (size_t row = 0; row < _values.size(); ++row) {
+      if (comparator(_values[row], search_value)) {
+        expected.push_back(RowID{ChunkID{static_cast<uint32_t>(row / 4)}, static_cast<ChunkOffset>(row % 4)});
+      }
+    }
+
+    const auto pos_list = TableScan{_table, ColumnID{0}, scan_type, search_value}.execute();
+    EXPECT_EQ(*pos_list, expected) << "scan type " << static_cast<int>(scan_type) << ", search value "
+                                   << search_value;
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::vector<int> _values{7, 3, 3, 9, 1, 5, 7, 7, 12, 3, 5};
+};
+
+TEST_F(OperatorsTableScanTest, ScanValueColumns) {
+  for (const auto search_value : {0, 1, 3, 4, 7, 12, 13}) {
+    check_all_scan_types(search_value);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanDictionaryColumns) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+
+  // the last chunk is still a value column, so both scan paths are combined
+  for (const auto search_value : {0, 1, 3, 4, 7, 12, 13}) {
+    check_all_scan_types(search_value);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithIndices) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  for (auto row = 0; row < 300; ++row) {
+    table->append({(row * 7) % 50});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+  table->get_chunk(ChunkID{0}).create_index<GroupKeyIndex>({ColumnID{0}});
+  table->get_chunk(ChunkID{1}).create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+
+  // narrow predicates use the indices, wide ones scan the columns
+  auto check_scan = [&](const ScanType scan_type, const int search_value, const auto& comparator) {
+    auto expected = PosList{};
+    for (auto row = 0; row < 300; ++row) {
+      if (comparator((row * 7) % 50, search_value)) {
+        expected.push_back(RowID{ChunkID{static_cast<uint32_t>(row / 100)}, static_cast<ChunkOffset>(row % 100)});
+      }
+    }
+    EXPECT_EQ(*TableScan(table, ColumnID{0}, scan_type, search_value).execute(), expected);
+  };
+  check_scan(ScanType::OpEquals, 21, std::equal_to<>{});
+  check_scan(ScanType::OpEquals, 60, std::equal_to<>{});
+  check_scan(ScanType::OpLessThan, 3, std::less<>{});
+  check_scan(ScanType::OpLessThanEquals, 30, std::less_equal<>{});
+  check_scan(ScanType::OpGreaterThan, 46, std::greater<>{});
+  check_scan(ScanType::OpGreaterThanEquals, 48, std::greater_equal<>{});
+  check_scan(ScanType::OpNotEquals, 21, std::not_equal_to<>{});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithScheduler) {
+  _table->compress_chunk(ChunkID{1});
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  for (const auto search_value : {0, 3, 7, 13}) {
+    check_all_scan_types(search_value);
+  }
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(OperatorsTableScanTest, ScanStringColumn) {
+  _table->compress_chunk(ChunkID{0});
+
+  // strings compare lexicographically: "12" < "3"
+  const auto pos_list = TableScan{_table, ColumnID{1}, ScanType::OpLessThan, "3"}.execute();
+  const auto expected = PosList{RowID{ChunkID{1}, 0u}, RowID{ChunkID{2}, 0u}};
+  EXPECT_EQ(*pos_list, expected);
+}
+
+TEST_F(OperatorsTableScanTest, SearchValueIsCast) {
+  const auto pos_list = TableScan{_table, ColumnID{0}, ScanType::OpEquals, "7"}.execute();
+  EXPECT_EQ(pos_list->size(), 3u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithSearchValuesOfOtherTypes) {
+  _table->compress_chunk(ChunkID{1});
+
+  // the search values are not truncated to the int column, e.g., "< 2.5" matches 1, but "= 2.5" matches nothing.
+  // the complete chunks have statistics, so they are pruned by the same predicates.
+  for (const auto search_value : {-0.5, 0.5, 1.0, 1.5, 2.5, 3.0, 6.9, 7.5, 12.5}) {
+    check_all_scan_types(search_value);
+  }
+  for (const auto search_value : {-1.5f, 3.5f, 7.25f}) {
+    check_all_scan_types(search_value);
+  }
+
+  // values beyond the range of int match all rows or none
+  for (const auto search_value : {int64_t{5'000'000'000}, int64_t{-5'000'000'000}, int64_t{7}}) {
+    check_all_scan_types(search_value);
+  }
+  check_all_scan_types(1e300);
+
+  // so do decimals given as strings
+  EXPECT_EQ(TableScan(_table, ColumnID{0}, ScanType::OpEquals, "2.5").execute()->size(), 0u);
+  EXPECT_EQ(TableScan(_table, ColumnID{0}, ScanType::OpLessThan, "3.5").execute()->size(), 4u);
+  EXPECT_THROW(TableScan(_table, ColumnID{0}, ScanType::OpLessThan, "abc").execute(), std::exception);
+}
+
+TEST_F(OperatorsTableScanTest, ScanFloatColumnWithDoubleSearchValue) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "float");
+  for (const auto value : {0.1f, 0.2f, 0.3f}) table->append({value});
+
+  // 0.1 cannot be represented as float: the float closest to it is greater than 0.1
+  EXPECT_EQ(TableScan(table, ColumnID{0}, ScanType::OpEquals, 0.1).execute()->size(), 0u);
+  EXPECT_EQ(TableScan(table, ColumnID{0}, ScanType::OpGreaterThan, 0.1).execute()->size(), 3u);
+  EXPECT_EQ(TableScan(table, ColumnID{0}, ScanType::OpLessThanEquals, 0.1).execute()->size(), 0u);
+  EXPECT_EQ(TableScan(table, ColumnID{0}, ScanType::OpEquals, 0.2f).execute()->size(), 1u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanNullableColumns) {
+  // rows 130 to 199 are NULL, so that the null bitmap has words with NULLs only as well as words without any
+  auto is_null = [](const int row) { return row % 3 == 0 || (row >= 130 && row < 200); };
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int", true);
+  for (auto row = 0; row < 300; ++row) {
+    table->append({is_null(row) ? NULL_VALUE : AllTypeVariant{row % 10}});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  auto check_scan = [&](const std::shared_ptr<const Table>& scanned_table, const ScanType scan_type,
+                        const int search_value, const auto& comparator) {
+    size_t expected_count = 0;
+    for (auto row = 0; row < 300; ++row) {
+      if (!is_null(row) && comparator(row % 10, search_value)) ++expected_count;
+    }
+    EXPECT_EQ(TableScan(scanned_table, ColumnID{0}, scan_type, search_value).execute()->size(), expected_count)
+        << "scan type " << static_cast<int>(scan_type) << ", search value " << search_value;
+  };
+
+  // the first and the last chunk consist of value columns, the second one of a dictionary column
+  // a reference table to all rows resolves the NULLs through the reference columns
+  auto all_rows = std::make_shared<PosList>();
+  for (auto row = 0; row < 300; ++row) {
+    all_rows->push_back(RowID{ChunkID{static_cast<uint32_t>(row / 100)}, static_cast<ChunkOffset>(row % 100)});
+  }
+  const auto scanned_tables = std::vector<std::shared_ptr<const Table>>{table, make_reference_table(table, all_rows)};
+
+  for (const auto& scanned_table : scanned_tables) {
+    for (const auto search_value : {-1, 0, 5, 9, 10}) {
+      check_scan(scanned_table, ScanType::OpEquals, search_value, std::equal_to<>{});
+      check_scan(scanned_table, ScanType::OpNotEquals, search_value, std::not_equal_to<>{});
+      check_scan(scanned_table, ScanType::OpLessThan, search_value, std::less<>{});
+      check_scan(scanned_table, ScanType::OpLessThanEquals, search_value, std::less_equal<>{});
+      check_scan(scanned_table, ScanType::OpGreaterThan, search_value, std::greater<>{});
+      check_scan(scanned_table, ScanType::OpGreaterThanEquals, search_value, std::greater_equal<>{});
+    }
+  }
+
+  // comparisons with NULL are never true
+  EXPECT_TRUE(TableScan(table, ColumnID{0}, ScanType::OpNotEquals, NULL_VALUE).execute()->empty());
+}
+
+TEST_F(OperatorsTableScanTest, EmptyTable) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+
+  const auto pos_list = TableScan{table, ColumnID{0}, ScanType::OpNotEquals, 1}.execute();
+  EXPECT_TRUE(pos_list->empty());
+}
+
+}  // namespace opossum
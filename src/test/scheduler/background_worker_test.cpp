@@ -0,0 +1,64 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/background_worker.hpp"
+
+namespace opossum {
+
+class SchedulerBackgroundWorkerTest : public BaseTest {};
+
+TEST_F(SchedulerBackgroundWorkerTest, RunsFunctionsInOrderOnOneThread) {
+  BackgroundWorker worker;
+  worker.wait();
+
+  std::vector<int> order;
+  std::vector<std::thread::id> thread_ids;
+  for (auto i = 0; i < 100; ++i) {
+    worker.schedule([&, i]() {
+      order.push_back(i);
+      thread_ids.push_back(std::this_thread::get_id());
+    });
+  }
+  worker.wait();
+
+  ASSERT_EQ(order.size(), 100u);
+  for (auto i = 0; i < 100; ++i) {
+    EXPECT_EQ(order[i], i);
+    EXPECT_EQ(thread_ids[i], thread_ids.front());
+  }
+  EXPECT_NE(thread_ids.front(), std::this_thread::get_id());
+}
+
+TEST_F(SchedulerBackgroundWorkerTest, RethrowsFirstException) {
+  BackgroundWorker worker;
+  std::atomic<int> counter{0};
+  worker.schedule([]() { throw std::logic_error("first"); });
+  worker.schedule([]() { throw std::runtime_error("second"); });
+  worker.schedule([&]() { ++counter; });
+
+  // the remaining functions still run, and the exception is reported only once
+  EXPECT_THROW(worker.wait(), std::logic_error);
+  EXPECT_EQ(counter, 1);
+  EXPECT_NO_THROW(worker.wait());
+}
+
+TEST_F(SchedulerBackgroundWorkerTest, DropsPendingFunctionsOnDestruction) {
+  std::atomic<int> counter{0};
+  {
+    BackgroundWorker worker;
+    for (auto i = 0; i < 1000; ++i) {
+      worker.schedule([&]() {
+        std::this_thread::yield();
+        ++counter;
+      });
+    }
+  }
+  EXPECT_LE(counter, 1000);
+}
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/job_task.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+class SchedulerTaskSchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+};
+
+TEST_F(SchedulerTaskSchedulerTest, JobTaskRunsOnce) {
+  auto counter = 0;
+  JobTask task{[&]() { ++counter; }};
+
+  EXPECT_FALSE(task.is_done());
+  EXPECT_TRUE(task.try_execute());
+  EXPECT_FALSE(task.try_execute());
+  EXPECT_TRUE(task.is_done());
+  EXPECT_EQ(counter, 1);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, ExecutesAllTasks) {
+  TaskScheduler scheduler{4};
+  EXPECT_EQ(scheduler.worker_count(), 4u);
+
+  std::atomic<size_t> counter{0};
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  for (auto i = 0; i < 1000; ++i) {
+    tasks.push_back(std::make_shared<JobTask>([&]() { ++counter; }));
+    scheduler.schedule(tasks.back());
+  }
+  scheduler.wait_for_tasks(tasks);
+
+  EXPECT_EQ(counter, 1000u);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, UsesMultipleWorkers) {
+  TaskScheduler scheduler{2};
+
+  // both tasks can only finish if they run at the same time
+  std::atomic<size_t> started{0};
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  for (auto i = 0; i < 2; ++i) {
+    tasks.push_back(std::make_shared<JobTask>([&]() {
+      ++started;
+      while (started < 2) std::this_thread::yield();
+    }));
+    scheduler.schedule(tasks.back());
+  }
+  scheduler.wait_for_tasks(tasks);
+
+  EXPECT_EQ(started, 2u);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, NestedTasksDoNotDeadlock) {
+  // every task waits for subtasks. With blocking waits, a single worker would be stuck.
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(1));
+
+  std::atomic<size_t> counter{0};
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  for (auto i = 0; i < 8; ++i) {
+    tasks.push_back(std::make_shared<JobTask>([&]() {
+      std::vector<std::shared_ptr<JobTask>> subtasks;
+      for (auto j = 0; j < 8; ++j) {
+        subtasks.push_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      }
+      CurrentScheduler::schedule_and_wait_for_tasks(subtasks);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(counter, 64u);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, RethrowsExceptions) {
+  TaskScheduler scheduler{2};
+
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  tasks.push_back(std::make_shared<JobTask>([]() {}));
+  tasks.push_back(std::make_shared<JobTask>([]() { throw std::runtime_error("failed"); }));
+  for (const auto& task : tasks) scheduler.schedule(task);
+
+  EXPECT_THROW(scheduler.wait_for_tasks(tasks), std::runtime_error);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, RunsInlineWithoutScheduler) {
+  EXPECT_FALSE(CurrentScheduler::is_set());
+
+  std::vector<std::thread::id> thread_ids;
+  std::vector<std::shared_ptr<JobTask>> tasks;
+  for (auto i = 0; i < 3; ++i) {
+    tasks.push_back(std::make_shared<JobTask>([&]() { thread_ids.push_back(std::this_thread::get_id()); }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(thread_ids, std::vector<std::thread::id>(3, std::this_thread::get_id()));
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#include <cstdint>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/hyper_log_log.hpp"
+#include "../lib/utils/mix_hash.hpp"
+
+namespace opossum {
+
+class StatisticsHyperLogLogTest : public BaseTest {};
+
+TEST_F(StatisticsHyperLogLogTest, EmptyEstimate) { EXPECT_EQ(HyperLogLog{}.estimate(), 0.0); }
+
+TEST_F(StatisticsHyperLogLogTest, SmallCardinalities) {
+  HyperLogLog hyper_log_log;
+  for (uint64_t value = 0; value < 100; ++value) {
+    // duplicates must not be counted
+    hyper_log_log.add_hash(mix_hash(value));
+    hyper_log_log.add_hash(mix_hash(value));
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 100.0, 5.0);
+}
+
+TEST_F(StatisticsHyperLogLogTest, LargeCardinalities) {
+  HyperLogLog hyper_log_log;
+  for (uint64_t value = 0; value < 1'000'000; ++value) {
+    hyper_log_log.add_hash(mix_hash(value));
+  }
+  // the standard error is about 1.6%
+  EXPECT_NEAR(hyper_log_log.estimate(), 1'000'000.0, 50'000.0);
+}
+
+TEST_F(StatisticsHyperLogLogTest, Merge) {
+  HyperLogLog left;
+  HyperLogLog right;
+  for (uint64_t value = 0; value < 20'000; ++value) {
+    left.add_hash(mix_hash(value));
+    right.add_hash(mix_hash(value + 10'000));
+  }
+  left.merge(right);
+  EXPECT_NEAR(left.estimate(), 30'000.0, 1'500.0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: 0..999 (unique), b: 0..9 (each value 100 times), c: strings "a".."d"
+    _table = std::make_shared<Table>(128);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    _table->add_column("c", "string");
+
+    for (auto i = 0; i < 1000; ++i) {
+      _table->append({i, i % 10, std::string(1, static_cast<char>('a' + i % 4))});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, RowAndDistinctCounts) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 1000u);
+  EXPECT_NEAR(statistics->distinct_count(ColumnID{0}), 1000.0, 50.0);
+  EXPECT_NEAR(statistics->distinct_count(ColumnID{1}), 10.0, 1.0);
+  EXPECT_NEAR(statistics->distinct_count(ColumnID{2}), 4.0, 1.0);
+  EXPECT_EQ(statistics->null_fraction(ColumnID{0}), 0.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, RangeSelectivity) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 250), 0.25, 0.02);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1, 0.02);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, -5), 0.0);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThanEquals, 5000), 1.0);
+  EXPECT_NEAR(statistics->estimate_cardinality(ColumnID{0}, ScanType::OpGreaterThan, 499), 500.0, 20.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, EqualitySelectivity) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 42), 0.001, 0.0002);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, 3), 0.1, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, 3), 0.9, 0.01);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{2}, ScanType::OpEquals, "b"), 0.25, 0.01);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{2}, ScanType::OpEquals, "x"), 0.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, SelectivityOfSearchValuesOfOtherTypes) {
+  const auto statistics = _table->table_statistics();
+  // no int is equal to 3.5, and "< 3.5" includes 3
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, 3.5), 0.0);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpLessThan, 3.5), 0.4, 0.02);
+  EXPECT_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, int64_t{5'000'000'000}), 1.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, IncrementalUpdate) {
+  const auto statistics = _table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 1000u);
+
+  // rows are appended to a chunk that has already been processed partially and to new chunks
+  for (auto i = 1000; i < 2000; ++i) {
+    _table->append({i, i % 10, std::string("e")});
+  }
+  EXPECT_EQ(_table->table_statistics(), statistics);
+  EXPECT_EQ(statistics->row_count(), 2000u);
+  EXPECT_NEAR(statistics->distinct_count(ColumnID{0}), 2000.0, 100.0);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 1000), 0.5, 0.03);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{2}, ScanType::OpEquals, "e"), 0.5, 0.05);
+}
+
+TEST_F(StatisticsTableStatisticsTest, CompressedChunks) {
+  auto table = std::make_shared<Table>(100, true);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 1000; ++i) {
+    table->append({i % 50});
+  }
+  table->wait_for_compression();
+
+  const auto statistics = table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 1000u);
+  EXPECT_NEAR(statistics->distinct_count(ColumnID{0}), 50.0, 3.0);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 25), 0.5, 0.05);
+}
+
+TEST_F(StatisticsTableStatisticsTest, JoinCardinality) {
+  auto other = std::make_shared<Table>();
+  other->add_column("x", "int");
+  for (auto i = 0; i < 10; ++i) {
+    other->append({i});
+  }
+
+  // every row of other matches the 100 rows of _table with the same value in column b
+  const auto cardinality = TableStatistics::estimate_join_cardinality(*_table->table_statistics(), ColumnID{1},
+                                                                      *other->table_statistics(), ColumnID{0});
+  EXPECT_NEAR(cardinality, 1000.0, 100.0);
+
+  // joining a table with itself
+  const auto statistics = _table->table_statistics();
+  EXPECT_NEAR(TableStatistics::estimate_join_cardinality(*statistics, ColumnID{0}, *statistics, ColumnID{0}), 1000.0,
+              50.0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, AddedColumnResetsStatistics) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int");
+  EXPECT_EQ(table->table_statistics()->column_count(), 1u);
+  table->add_column("b", "float");
+  EXPECT_EQ(table->table_statistics()->column_count(), 2u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/attribute_vector_factory.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageAttributeVectorTest, FittedSetAndGet) {
+  FittedAttributeVector<uint16_t> attribute_vector{3};
+  attribute_vector.set(0, ValueID{7});
+  attribute_vector.set(2, ValueID{65535});
+
+  EXPECT_EQ(attribute_vector.size(), 3u);
+  EXPECT_EQ(attribute_vector.width(), 2u);
+  EXPECT_EQ(attribute_vector.get(0), ValueID{7});
+  EXPECT_EQ(attribute_vector.get(1), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(2), ValueID{65535});
+}
+
+TEST_F(StorageAttributeVectorTest, BitPackedSetAndGet) {
+  // 7 bits per value make values span word boundaries
+  BitPackedAttributeVector attribute_vector{100, 7};
+  for (size_t i = 0; i < attribute_vector.size(); ++i) {
+    attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 37) % 128)});
+  }
+  // overwriting a value must not touch its neighbours
+  attribute_vector.set(9, ValueID{127});
+  attribute_vector.set(9, ValueID{1});
+
+  EXPECT_EQ(attribute_vector.width(), 1u);
+  EXPECT_EQ(attribute_vector.bit_width(), 7u);
+  for (size_t i = 0; i < attribute_vector.size(); ++i) {
+    const auto expected = i == 9 ? 1u : (i * 37) % 128;
+    EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>(expected)});
+  }
+}
+
+TEST_F(StorageAttributeVectorTest, FactoryChoosesSmallestWidth) {
+  auto bit_packed = std::dynamic_pointer_cast<BitPackedAttributeVector>(make_attribute_vector(16, 10));
+  ASSERT_NE(bit_packed, nullptr);
+  EXPECT_EQ(bit_packed->bit_width(), 4u);
+  EXPECT_EQ(bit_packed->size(), 10u);
+
+  EXPECT_EQ(make_attribute_vector(1, 10)->width(), 1u);
+  EXPECT_EQ(make_attribute_vector(17, 10)->width(), 1u);
+  EXPECT_NE(std::dynamic_pointer_cast<FittedAttributeVector<uint8_t>>(make_attribute_vector(256, 10)), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FittedAttributeVector<uint16_t>>(make_attribute_vector(257, 10)), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FittedAttributeVector<uint32_t>>(make_attribute_vector(65537, 10)), nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,135 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/storage/chunk_statistics.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageChunkStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+
+    for (auto i = 0; i < 10; ++i) {
+      _table->append({i * 10, std::string(1, static_cast<char>('a' + i % 4))});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageChunkStatisticsTest, FullChunksHaveStatistics) {
+  // the last chunk still receives inserts
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}).statistics());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1}).statistics());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2}).statistics());
+
+  const auto statistics = _table->get_chunk(ChunkID{1}).statistics();
+  const auto& column_statistics =
+      static_cast<const ChunkColumnStatistics<int>&>(*statistics->column_statistics(ColumnID{0}));
+  EXPECT_EQ(column_statistics.min(), 40);
+  EXPECT_EQ(column_statistics.max(), 70);
+  EXPECT_EQ(column_statistics.null_count(), 0u);
+  EXPECT_EQ(column_statistics.distinct_count(), 4u);
+}
+
+TEST_F(StorageChunkStatisticsTest, DictionaryStatistics) {
+  _table->compress_chunk(ChunkID{0});
+
+  const auto statistics = _table->get_chunk(ChunkID{0}).statistics();
+  const auto& column_statistics =
+      static_cast<const ChunkColumnStatistics<std::string>&>(*statistics->column_statistics(ColumnID{1}));
+  EXPECT_EQ(column_statistics.min(), "a");
+  EXPECT_EQ(column_statistics.max(), "d");
+  EXPECT_EQ(column_statistics.distinct_count(), 4u);
+}
+
+TEST_F(StorageChunkStatisticsTest, NullableColumns) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int", true);
+  for (const auto& value : {AllTypeVariant{3}, NULL_VALUE, AllTypeVariant{1}, NULL_VALUE}) table->append({value});
+  for (auto i = 0; i < 5; ++i) table->append({NULL_VALUE});
+
+  // NULLs do not contribute to min and max, and a chunk of NULLs only has no statistics for the column
+  for (const auto compress : {false, true}) {
+    if (compress) table->compress_chunk(ChunkID{0});
+    const auto statistics = table->get_chunk(ChunkID{0}).statistics();
+    const auto& column_statistics =
+        static_cast<const ChunkColumnStatistics<int>&>(*statistics->column_statistics(ColumnID{0}));
+    EXPECT_EQ(column_statistics.min(), 1);
+    EXPECT_EQ(column_statistics.max(), 3);
+    EXPECT_EQ(column_statistics.null_count(), 2u);
+    EXPECT_TRUE(statistics->can_prune(ColumnID{0}, ScanType::OpEquals, NULL_VALUE));
+    EXPECT_FALSE(table->get_chunk(ChunkID{1}).statistics()->column_statistics(ColumnID{0}));
+  }
+}
+
+TEST_F(StorageChunkStatisticsTest, DistinctCountEstimate) {
+  auto table = std::make_shared<Table>(10'000);
+  table->add_column("a", "int");
+  for (auto i = 0; i < 10'001; ++i) table->append({i % 3'000});
+
+  const auto statistics = table->get_chunk(ChunkID{0}).statistics();
+  const auto distinct_count = statistics->column_statistics(ColumnID{0})->distinct_count();
+  EXPECT_GT(distinct_count, 2'800u);
+  EXPECT_LT(distinct_count, 3'200u);
+}
+
+TEST_F(StorageChunkStatisticsTest, CanPrune) {
+  const ChunkColumnStatistics<int> statistics{10, 20, 0, 5};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 5));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 10));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 21));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 10));
+  EXPECT_TRUE((ChunkColumnStatistics<int>{10, 10, 0, 1}.can_prune(ScanType::OpNotEquals, 10)));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 10));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 20));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThan, 19));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThanEquals, 21));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 20));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{"25"}));
+}
+
+TEST_F(StorageChunkStatisticsTest, CanPruneWithSearchValuesOfOtherTypes) {
+  const ChunkColumnStatistics<int> statistics{10, 20, 0, 5};
+
+  // the search values are not truncated, e.g., 10 < 10.5
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, AllTypeVariant{10.5}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, AllTypeVariant{9.5}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{15.5}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, AllTypeVariant{19.5}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, AllTypeVariant{"20.5"}));
+
+  // values beyond the range of int do not throw
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, AllTypeVariant{int64_t{5'000'000'000}}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, AllTypeVariant{int64_t{5'000'000'000}}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{-1e20}));
+}
+
+TEST_F(StorageChunkStatisticsTest, ScanSkipsPrunedChunks) {
+  // statistics claiming that the first chunk only holds 1000 make the scan skip it
+  _table->get_chunk(ChunkID{0}).set_statistics(
+      std::make_shared<ChunkStatistics>(std::vector<std::shared_ptr<const BaseChunkColumnStatistics>>{
+          std::make_shared<ChunkColumnStatistics<int>>(1000, 1000, 0, 1), nullptr}));
+
+  const auto pos_list = TableScan{_table, ColumnID{0}, ScanType::OpLessThan, 50}.execute();
+  EXPECT_EQ(*pos_list, (PosList{RowID{ChunkID{1}, 0u}}));
+
+  // no statistics for column b
+  const auto pos_list_b = TableScan{_table, ColumnID{1}, ScanType::OpEquals, "a"}.execute();
+  EXPECT_EQ(pos_list_b->size(), 3u);
+}
+
+}  // namespace opossum
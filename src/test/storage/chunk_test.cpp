@@ -6,6 +6,9 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_column.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -49,6 +52,32 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, FailedAppendLeavesChunkUnchanged) {
+  c.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>("int"));
+  c.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>("int"));
+
+  // the first value could be appended, but the second cannot, so none of them is
+  EXPECT_THROW(c.append({1, "abc"}), std::exception);
+  EXPECT_EQ(c.get_column(ColumnID{0})->size(), 0u);
+
+  c.append({2, 3});
+  EXPECT_EQ(c.size(), 1u);
+  EXPECT_EQ((*c.get_column(ColumnID{0}))[0], AllTypeVariant{2});
+  EXPECT_EQ((*c.get_column(ColumnID{1}))[0], AllTypeVariant{3});
+}
+
+TEST_F(StorageChunkTest, MarkImmutable) {
+  c.add_column(vc_int);
+  EXPECT_FALSE(c.is_immutable());
+  c.mark_immutable();
+  EXPECT_TRUE(c.is_immutable());
+
+  if (IS_DEBUG) {
+    EXPECT_THROW(c.append({5}), std::exception);
+    EXPECT_EQ(c.size(), 3u);
+  }
+}
+
 TEST_F(StorageChunkTest, RetrieveColumn) {
   c.add_column(vc_int);
   c.add_column(vc_str);
@@ -58,6 +87,45 @@ TEST_F(StorageChunkTest, RetrieveColumn) {
   EXPECT_EQ(base_col->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, ReplaceColumn) {
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+
+  auto previous_column = c.get_column(ColumnID{0});
+  c.replace_column(ColumnID{0}, make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int));
+  EXPECT_NE(c.get_column(ColumnID{0}), previous_column);
+  EXPECT_EQ((*c.get_column(ColumnID{0}))[2], AllTypeVariant{3});
+  EXPECT_EQ(c.size(), 3u);
+}
+
+TEST_F(StorageChunkTest, CreateAndGetIndices) {
+  c.add_column(make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int));
+  c.add_column(make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", vc_str));
+
+  EXPECT_TRUE(c.get_indices({ColumnID{0}}).empty());
+
+  const auto group_key_index = c.create_index<GroupKeyIndex>({ColumnID{0}});
+  const auto art_index = c.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  c.create_index<GroupKeyIndex>({ColumnID{1}});
+
+  EXPECT_EQ(c.get_indices({ColumnID{0}}).size(), 2u);
+  EXPECT_EQ(c.get_indices({ColumnID{1}}).size(), 1u);
+  EXPECT_TRUE(c.get_indices({ColumnID{0}, ColumnID{1}}).empty());
+  EXPECT_EQ(c.get_index(ColumnIndexType::GroupKey, {ColumnID{0}}), group_key_index);
+  EXPECT_EQ(c.get_index(ColumnIndexType::AdaptiveRadixTree, {ColumnID{0}}), art_index);
+  EXPECT_EQ(c.get_index(ColumnIndexType::AdaptiveRadixTree, {ColumnID{1}}), nullptr);
+
+  // the positions of the value 4
+  const auto begin = group_key_index->lower_bound({4});
+  ASSERT_EQ(group_key_index->upper_bound({4}) - begin, 1);
+  EXPECT_EQ(*begin, 0u);
+}
+
+TEST_F(StorageChunkTest, IndicesRequireDictionaryColumns) {
+  c.add_column(vc_int);
+  EXPECT_THROW(c.create_index<GroupKeyIndex>({ColumnID{0}}), std::logic_error);
+}
+
 TEST_F(StorageChunkTest, UnknownColumnType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
@@ -66,4 +134,12 @@ TEST_F(StorageChunkTest, UnknownColumnType) {
   }
 }
 
+TEST_F(StorageChunkTest, EstimateMemoryUsage) {
+  const auto empty_bytes = c.estimate_memory_usage();
+  c.add_column(vc_int);
+  c.add_column(vc_str);
+  EXPECT_GE(c.estimate_memory_usage(),
+            empty_bytes + vc_int->estimate_memory_usage() + vc_str->estimate_memory_usage());
+}
+
 }  // namespace opossum
@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/create_iterable_from_column.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageColumnIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vc_str = std::make_shared<ValueColumn<std::string>>();
+    for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) {
+      vc_str->append(value);
+    }
+    dc_str = std::make_shared<DictionaryColumn<std::string>>(vc_str);
+  }
+
+  std::vector<std::string> _collect(const BaseColumn& column) {
+    std::vector<std::string> values(column.size());
+    resolve_column_type<std::string>(column, [&](const auto& typed_column) {
+      create_iterable_from_column<std::string>(typed_column).for_each([&](const auto& column_value) {
+        EXPECT_FALSE(column_value.is_null());
+        values[column_value.chunk_offset()] = column_value.value();
+      });
+    });
+    return values;
+  }
+
+  const std::vector<std::string> expected{"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"};
+  std::shared_ptr<ValueColumn<std::string>> vc_str;
+  std::shared_ptr<DictionaryColumn<std::string>> dc_str;
+};
+
+TEST_F(StorageColumnIterablesTest, ValueColumnForEach) { EXPECT_EQ(_collect(*vc_str), expected); }
+
+TEST_F(StorageColumnIterablesTest, DictionaryColumnForEach) { EXPECT_EQ(_collect(*dc_str), expected); }
+
+TEST_F(StorageColumnIterablesTest, ReferenceColumnForEach) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("name", "string");
+  for (const auto& value : expected) table->append({value});
+  table->compress_chunk(ChunkID{0});
+
+  // references the rows in reverse order, across a dictionary and a value column
+  auto pos_list = std::make_shared<PosList>();
+  for (auto row = expected.size(); row-- > 0;) {
+    pos_list->push_back(RowID{ChunkID{static_cast<uint32_t>(row / 4)}, static_cast<ChunkOffset>(row % 4)});
+  }
+  ReferenceColumn reference_column{table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(_collect(reference_column), std::vector<std::string>(expected.rbegin(), expected.rend()));
+}
+
+TEST_F(StorageColumnIterablesTest, RandomAccess) {
+  create_iterable_from_column(*dc_str).with_iterators([&](auto it, auto end) {
+    EXPECT_EQ(std::distance(it, end), 6);
+    EXPECT_EQ((it + 4)->value(), "Hasso");
+    EXPECT_EQ((end - 1)->chunk_offset(), 5u);
+  });
+}
+
+TEST_F(StorageColumnIterablesTest, BitPackedDictionaryColumn) {
+  auto vc_int = std::make_shared<ValueColumn<int>>();
+  for (auto i = 0; i < 100; ++i) vc_int->append(i % 3);
+  DictionaryColumn<int> dc_int{vc_int};
+
+  auto sum = 0;
+  create_iterable_from_column(dc_int).for_each([&](const auto& column_value) { sum += column_value.value(); });
+  EXPECT_EQ(sum, 99);
+}
+
+}  // namespace opossum
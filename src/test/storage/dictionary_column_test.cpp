@@ -0,0 +1,118 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/base_attribute_vector.hpp"
+#include "../lib/storage/base_column.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageDictionaryColumnTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>();
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageDictionaryColumnTest, CompressColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+
+  // Test values
+  EXPECT_EQ(dict_col->get(0), "Bill");
+  EXPECT_EQ(dict_col->get(3), "Steve");
+  EXPECT_EQ((*dict_col)[4], AllTypeVariant{"Hasso"});
+  EXPECT_EQ(dict_col->value_by_value_id(ValueID{0}), "Alexander");
+}
+
+TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+  auto col = make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionaryColumn<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), ValueID{2});
+  EXPECT_EQ(dict_col->upper_bound(4), ValueID{3});
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{5}), ValueID{3});
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{5}), ValueID{3});
+
+  EXPECT_EQ(dict_col->lower_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(10), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionaryColumnTest, FittedAttributeVectorWidth) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i);
+  auto dict_col = std::make_shared<DictionaryColumn<int>>(vc_int);
+
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 2u);
+  EXPECT_EQ(dict_col->attribute_vector()->size(), 300u);
+  EXPECT_EQ(dict_col->get(299), 299);
+}
+
+TEST_F(StorageDictionaryColumnTest, IsImmutable) {
+  vc_int->append(1);
+  auto dict_col = std::make_shared<DictionaryColumn<int>>(vc_int);
+  EXPECT_THROW(dict_col->append(2), std::exception);
+  EXPECT_EQ(dict_col->size(), 1u);
+}
+
+TEST_F(StorageDictionaryColumnTest, NullValues) {
+  auto vc_nullable = std::make_shared<ValueColumn<int>>(0, true);
+  vc_nullable->append(4);
+  vc_nullable->append(NULL_VALUE);
+  vc_nullable->append(2);
+  vc_nullable->append(4);
+  vc_nullable->append(NULL_VALUE);
+  auto dict_col = std::make_shared<DictionaryColumn<int>>(vc_nullable);
+
+  // NULL is not part of the dictionary, but has the value id that follows its last entry
+  EXPECT_TRUE(dict_col->is_nullable());
+  EXPECT_EQ(dict_col->unique_values_count(), 2u);
+  EXPECT_EQ(dict_col->null_value_id(), ValueID{2});
+  EXPECT_EQ(dict_col->attribute_vector()->get(1), dict_col->null_value_id());
+  EXPECT_TRUE(dict_col->is_null(4));
+  EXPECT_FALSE(dict_col->is_null(3));
+  EXPECT_TRUE(variant_is_null((*dict_col)[1]));
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant{2});
+}
+
+TEST_F(StorageDictionaryColumnTest, EstimateMemoryUsage) {
+  for (int i = 0; i < 1000; ++i) vc_int->append(i % 4);
+  const auto dict_int = std::make_shared<DictionaryColumn<int>>(vc_int);
+  // four distinct values need two bits per value id
+  EXPECT_LT(dict_int->estimate_memory_usage(), vc_int->estimate_memory_usage() / 4);
+
+  // strings that do not fit into the string object count their characters
+  vc_str->append(std::string(1000, 'a'));
+  const auto dict_str = std::make_shared<DictionaryColumn<std::string>>(vc_str);
+  EXPECT_GT(dict_str->estimate_memory_usage(), 1000u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../../lib/storage/dictionary_column.hpp"
+#include "../../../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../../../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  // creates an index on a column with the given number of distinct values (each occurring twice), so that the tree
+  // needs nodes of different sizes
+  void create_index(const int distinct_values) {
+    auto values = std::make_shared<ValueColumn<int>>();
+    for (auto round = 0; round < 2; ++round) {
+      for (auto value = distinct_values - 1; value >= 0; --value) {
+        values->append(value * 2);
+      }
+    }
+    _column = std::make_shared<DictionaryColumn<int>>(values);
+    _index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>{_column});
+  }
+
+  // checks that every value is found at the correct positions and that values in between are not found
+  void check_lookups(const int distinct_values) {
+    for (auto value = 0; value < distinct_values; ++value) {
+      const auto begin = _index->lower_bound({value * 2});
+      const auto end = _index->upper_bound({value * 2});
+      ASSERT_EQ(end - begin, 2);
+      for (auto it = begin; it != end; ++it) {
+        EXPECT_EQ(_column->get(*it), value * 2);
+      }
+
+      EXPECT_EQ(_index->lower_bound({value * 2 + 1}), end);
+      EXPECT_EQ(_index->upper_bound({value * 2 + 1}), end);
+    }
+    EXPECT_EQ(_index->lower_bound({-1}), _index->cbegin());
+    EXPECT_EQ(_index->upper_bound({distinct_values * 2}), _index->cend());
+  }
+
+  std::shared_ptr<DictionaryColumn<int>> _column;
+  std::shared_ptr<AdaptiveRadixTreeIndex> _index;
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, SmallNodes) {
+  for (const auto distinct_values : {1, 2, 4, 5, 16, 17}) {
+    create_index(distinct_values);
+    check_lookups(distinct_values);
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, LargeNodes) {
+  for (const auto distinct_values : {48, 49, 256, 257, 70'000}) {
+    create_index(distinct_values);
+    check_lookups(distinct_values);
+  }
+}
+
+}  // namespace opossum
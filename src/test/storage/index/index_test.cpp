@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../../lib/storage/dictionary_column.hpp"
+#include "../../../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../../../lib/storage/index/base_index.hpp"
+#include "../../../lib/storage/index/group_key/group_key_index.hpp"
+#include "../../../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+// runs the same tests for all single-column index types
+class StorageIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto values = std::make_shared<ValueColumn<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      values->append(value);
+    }
+    _column = std::make_shared<DictionaryColumn<std::string>>(values);
+  }
+
+  // calls func with an index of every type on the given column
+  template <typename Functor>
+  void for_each_index_type(const std::shared_ptr<const BaseColumn>& column, const Functor& func) {
+    const auto columns = std::vector<std::shared_ptr<const BaseColumn>>{column};
+    func(GroupKeyIndex{columns});
+    func(AdaptiveRadixTreeIndex{columns});
+  }
+
+  // returns the positions in [begin, end), sorted for comparison
+  static std::vector<ChunkOffset> positions(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    std::vector<ChunkOffset> chunk_offsets(begin, end);
+    std::sort(chunk_offsets.begin(), chunk_offsets.end());
+    return chunk_offsets;
+  }
+
+  std::shared_ptr<DictionaryColumn<std::string>> _column;
+};
+
+TEST_F(StorageIndexTest, IndexType) {
+  const auto columns = std::vector<std::shared_ptr<const BaseColumn>>{_column};
+  EXPECT_EQ(GroupKeyIndex{columns}.type(), ColumnIndexType::GroupKey);
+  EXPECT_EQ(AdaptiveRadixTreeIndex{columns}.type(), ColumnIndexType::AdaptiveRadixTree);
+
+  for_each_index_type(_column, [&](const BaseIndex& index) {
+    EXPECT_TRUE(index.is_index_for(columns));
+    EXPECT_FALSE(index.is_index_for({}));
+  });
+}
+
+TEST_F(StorageIndexTest, FullRange) {
+  for_each_index_type(_column, [&](const BaseIndex& index) {
+    // positions are sorted by value
+    const auto expected = std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7};
+    EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), expected);
+  });
+}
+
+TEST_F(StorageIndexTest, PointLookup) {
+  for_each_index_type(_column, [&](const BaseIndex& index) {
+    EXPECT_EQ(positions(index.lower_bound({"delta"}), index.upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+    EXPECT_EQ(positions(index.lower_bound({"inbox"}), index.upper_bound({"inbox"})), std::vector<ChunkOffset>{7});
+    EXPECT_EQ(positions(index.lower_bound({"apple"}), index.upper_bound({"apple"})), std::vector<ChunkOffset>{4});
+
+    // values that do not exist
+    EXPECT_EQ(index.lower_bound({"echo"}), index.upper_bound({"echo"}));
+    EXPECT_EQ(index.lower_bound({"aaa"}), index.cbegin());
+    EXPECT_EQ(index.lower_bound({"zulu"}), index.cend());
+    EXPECT_EQ(index.upper_bound({"zulu"}), index.cend());
+  });
+}
+
+TEST_F(StorageIndexTest, RangeLookup) {
+  for_each_index_type(_column, [&](const BaseIndex& index) {
+    EXPECT_EQ(positions(index.lower_bound({"charlie"}), index.upper_bound({"frank"})),
+              (std::vector<ChunkOffset>{1, 2, 3, 5, 6}));
+    EXPECT_EQ(positions(index.lower_bound({"e"}), index.cend()), (std::vector<ChunkOffset>{0, 2, 7}));
+    EXPECT_EQ(positions(index.cbegin(), index.lower_bound({"d"})), (std::vector<ChunkOffset>{4, 5, 6}));
+  });
+}
+
+TEST_F(StorageIndexTest, EmptyColumn) {
+  const auto column = std::make_shared<DictionaryColumn<int>>(std::make_shared<ValueColumn<int>>());
+  for_each_index_type(column, [&](const BaseIndex& index) {
+    EXPECT_EQ(index.cbegin(), index.cend());
+    EXPECT_EQ(index.lower_bound({1}), index.cend());
+    EXPECT_EQ(index.upper_bound({1}), index.cend());
+  });
+}
+
+TEST_F(StorageIndexTest, OnlySingleDictionaryColumns) {
+  const auto value_column = std::vector<std::shared_ptr<const BaseColumn>>{std::make_shared<ValueColumn<int>>()};
+  EXPECT_THROW(GroupKeyIndex{value_column}, std::logic_error);
+  EXPECT_THROW(AdaptiveRadixTreeIndex{value_column}, std::logic_error);
+
+  const auto two_columns = std::vector<std::shared_ptr<const BaseColumn>>{_column, _column};
+  EXPECT_THROW(GroupKeyIndex{two_columns}, std::logic_error);
+  EXPECT_THROW(AdaptiveRadixTreeIndex{two_columns}, std::logic_error);
+}
+
+}  // namespace opossum
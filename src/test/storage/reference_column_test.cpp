@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageReferenceColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+
+    _table->append({123, 456.7f});
+    _table->append({1234, 457.7f});
+    _table->append({12345, 458.7f});
+    _table->append({54321, 454.7f});
+    _table->append({12345, 456.7f});
+    _table->compress_chunk(ChunkID{0});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageReferenceColumnTest, RetrievesValues) {
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, 1u}, {ChunkID{0}, 2u}, {ChunkID{0}, 0u}});
+  ReferenceColumn reference_column{_table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(reference_column.size(), 3u);
+  EXPECT_EQ(reference_column[0], AllTypeVariant{12345});
+  EXPECT_EQ(reference_column[1], AllTypeVariant{12345});
+  EXPECT_EQ(reference_column[2], AllTypeVariant{123});
+
+  EXPECT_EQ(reference_column.referenced_table(), _table);
+  EXPECT_EQ(reference_column.referenced_column_id(), ColumnID{0});
+  EXPECT_EQ(reference_column.pos_list(), pos_list);
+}
+
+TEST_F(StorageReferenceColumnTest, IsImmutable) {
+  ReferenceColumn reference_column{_table, ColumnID{0}, std::make_shared<PosList>()};
+  EXPECT_THROW(reference_column.append(1), std::exception);
+}
+
+TEST_F(StorageReferenceColumnTest, MakeReferenceTable) {
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, 1u}, {ChunkID{1}, 0u}});
+  const auto reference_table = make_reference_table(_table, pos_list);
+
+  EXPECT_EQ(reference_table->col_count(), 2u);
+  EXPECT_EQ(reference_table->column_name(ColumnID{1}), "b");
+  EXPECT_EQ(reference_table->column_type(ColumnID{1}), "float");
+  EXPECT_EQ(reference_table->row_count(), 2u);
+
+  // all columns share the same position list instead of copying it
+  const auto& chunk = reference_table->get_chunk(ChunkID{0});
+  const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(ColumnID{1}));
+  ASSERT_TRUE(column_a && column_b);
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "float");
+  expected->append({1234, 457.7f});
+  expected->append({54321, 454.7f});
+  EXPECT_TABLE_EQ(reference_table, expected, true);
+}
+
+TEST_F(StorageReferenceColumnTest, ChainedScansReferenceDataTable) {
+  const auto first_result =
+      make_reference_table(_table, TableScan{_table, ColumnID{0}, ScanType::OpGreaterThan, 1000}.execute());
+  const auto second_result = make_reference_table(
+      first_result, TableScan{first_result, ColumnID{1}, ScanType::OpLessThan, 457.0f}.execute());
+
+  // the result of the second scan points to the data table, not to the result of the first scan
+  const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      second_result->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_TRUE(column);
+  EXPECT_EQ(column->referenced_table(), _table);
+  EXPECT_EQ(*column->pos_list(), (PosList{{ChunkID{1}, 0u}, {ChunkID{1}, 1u}}));
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "float");
+  expected->append({54321, 454.7f});
+  expected->append({12345, 456.7f});
+  EXPECT_TABLE_EQ(second_result, expected, true);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -62,10 +63,52 @@ TEST_F(StorageStorageManagerTest, TableNames) {
 
 TEST_F(StorageStorageManagerTest, Print) {
   auto& sm = StorageManager::get();
+  const auto t2 = sm.get_table("second_table");
+  t2->add_column("a", "int");
+  t2->append({1});
+
   std::ostringstream test_stream;
   sm.print(test_stream);
-  std::string expected = "Table Name (#Columns, #Rows, #Chunks)\nfirst_table (0, 0, 1)\nsecond_table (0, 0, 1)\n";
+  const auto t1_bytes = std::to_string(sm.get_table("first_table")->estimate_memory_usage());
+  const auto t2_bytes = std::to_string(t2->estimate_memory_usage());
+  const auto column_bytes = std::to_string(t2->estimate_memory_usage(ColumnID{0}));
+  std::string expected = "Table Name (#Columns, #Rows, #Chunks, #Bytes)\n  Column Name (Type, #Bytes)\n"
+                         "first_table (0, 0, 1, " + t1_bytes + ")\n"
+                         "second_table (1, 1, 1, " + t2_bytes + ")\n"
+                         "  a (int, " + column_bytes + ")\n";
   EXPECT_STREQ(test_stream.str().c_str(), expected.c_str());
 }
 
+TEST_F(StorageStorageManagerTest, AddTableTwice) {
+  auto& sm = StorageManager::get();
+  EXPECT_THROW(sm.add_table("first_table", std::make_shared<Table>()), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentAccess) {
+  auto& sm = StorageManager::get();
+  auto first_table = sm.get_table("first_table");
+
+  std::vector<std::thread> threads;
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    // readers
+    threads.emplace_back([&]() {
+      for (auto i = 0; i < 1000; ++i) {
+        EXPECT_EQ(sm.get_table("first_table"), first_table);
+        EXPECT_TRUE(sm.has_table("second_table"));
+      }
+    });
+    // DDL
+    threads.emplace_back([&, thread_id]() {
+      const auto name = "table_" + std::to_string(thread_id);
+      for (auto i = 0; i < 100; ++i) {
+        sm.add_table(name, std::make_shared<Table>());
+        sm.drop_table(name);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(sm.table_names().size(), 2u);
+}
+
 }  // namespace opossum
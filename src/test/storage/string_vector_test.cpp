@@ -0,0 +1,102 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/string_vector.hpp"
+
+namespace opossum {
+
+class StorageStringVectorTest : public BaseTest {
+ protected:
+  // returns the sign of a comparison result
+  static int sign(const int value) { return (value > 0) - (value < 0); }
+};
+
+TEST_F(StorageStringVectorTest, PushBackAndAccess) {
+  StringVector strings;
+  strings.push_back("Hasso");
+  strings.push_back("");
+  strings.push_back("Plattner");
+
+  EXPECT_EQ(strings.size(), 3u);
+  EXPECT_EQ(strings[0], "Hasso");
+  EXPECT_EQ(strings[1], "");
+  EXPECT_EQ(strings[2], "Plattner");
+  EXPECT_EQ(strings.at(2), "Plattner");
+  EXPECT_THROW(strings.at(3), std::exception);
+
+  // all characters are stored in a single buffer
+  EXPECT_EQ(strings.chars(3), "HassoPlattner");
+  EXPECT_EQ(strings.chars(1), "Hasso");
+
+  const auto copy = std::vector<std::string>(strings.cbegin(), strings.cend());
+  EXPECT_EQ(copy, (std::vector<std::string>{"Hasso", "", "Plattner"}));
+}
+
+TEST_F(StorageStringVectorTest, CreateFromVector) {
+  const StringVector strings = std::vector<std::string>{"a", "bc", "def"};
+  EXPECT_EQ(strings.size(), 3u);
+  EXPECT_EQ(strings[1], "bc");
+  EXPECT_EQ(strings.offsets(), (pmr_vector<size_t>{0, 1, 3, 6}));
+}
+
+TEST_F(StorageStringVectorTest, Append) {
+  const StringVector source = std::vector<std::string>{"zero", "one", "two", "three"};
+  StringVector strings;
+  strings.push_back("first");
+  strings.append(source, 1, 2);
+  strings.append(source, 3, 0);
+
+  EXPECT_EQ(strings.size(), 3u);
+  EXPECT_EQ(strings[0], "first");
+  EXPECT_EQ(strings[1], "one");
+  EXPECT_EQ(strings[2], "two");
+  EXPECT_EQ(strings.prefix(2), StringVector::make_prefix("two"));
+
+  strings.clear();
+  EXPECT_TRUE(strings.empty());
+  strings.push_back("again");
+  EXPECT_EQ(strings[0], "again");
+}
+
+TEST_F(StorageStringVectorTest, ViewsStayValidWhileGrowing) {
+  StringVector strings;
+  strings.reserve(1000);
+  strings.push_back("first");
+  const auto first = strings[0];
+  const auto allocated_bytes = strings.allocated_bytes();
+
+  // the character buffer is replaced, but the previous one stays alive
+  for (auto index = 1; index < 1000; ++index) strings.push_back(std::string(static_cast<size_t>(index % 20), 'x'));
+  EXPECT_EQ(first, "first");
+  EXPECT_EQ(strings[0], "first");
+  EXPECT_EQ(strings[999], std::string(19, 'x'));
+  EXPECT_GT(strings.allocated_bytes(), allocated_bytes);
+
+  // strings cannot be accessed after clear() anyway, so the retired buffers are released
+  strings.clear();
+  EXPECT_LT(strings.allocated_bytes(), allocated_bytes + 1000 * (sizeof(size_t) + sizeof(uint32_t)));
+}
+
+TEST_F(StorageStringVectorTest, CompareUsesPrefixes) {
+  const auto values =
+      std::vector<std::string>{"", "a", "ab", "abcd", "abcde", "abcdf", "b", "\xff", std::string(1, '\0')};
+  const StringVector strings = values;
+
+  // prefixes are compared as unsigned characters, like std::string does
+  for (size_t index = 0; index < values.size(); ++index) {
+    for (const auto& value : values) {
+      const auto prefix = StringVector::make_prefix(value);
+      EXPECT_EQ(sign(strings.compare(index, value, prefix)), sign(values[index].compare(value)))
+          << "'" << values[index] << "' vs. '" << value << "'";
+    }
+  }
+
+  EXPECT_EQ(StringVector::make_prefix("abcdef"), 0x61626364u);
+  EXPECT_EQ(StringVector::make_prefix("ab"), 0x61620000u);
+}
+
+}  // namespace opossum
@@ -1,6 +1,10 @@
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,6 +12,10 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
+#include "../lib/storage/create_iterable_from_column.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
@@ -22,6 +30,33 @@ class StorageTableTest : public BaseTest {
   Table t{2};
 };
 
+// Counts the bytes that are currently allocated from it and forwards all allocations to new and delete. Like an
+// exhausted arena, it can be told to throw std::bad_alloc instead.
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  size_t allocated_bytes() const { return _allocated_bytes; }
+
+  void set_exhausted(const bool exhausted) { _exhausted = exhausted; }
+
+ protected:
+  void* do_allocate(const size_t bytes, const size_t alignment) override {
+    if (_exhausted) throw std::bad_alloc{};
+    _allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override {
+    _allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+ private:
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic_bool _exhausted{false};
+};
+
 TEST_F(StorageTableTest, ChunkCount) {
   EXPECT_EQ(t.chunk_count(), 1u);
   t.append({4, "Hello,"});
@@ -71,4 +106,330 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, ChunksArePreSized) {
+  Table table{1000};
+  table.add_column("col_1", "int");
+  table.create_new_chunk();
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(chunk_id).get_column(ColumnID{0}));
+    EXPECT_GE(column->values().capacity(), 1000u);
+  }
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({1, "first"});
+
+  auto ints = std::make_shared<ValueColumn<int>>(std::vector<int>{2, 3, 4, 5});
+  auto strings = std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"a", "b", "c", "d"});
+  t.append_columns({ints, strings});
+
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).size(), 1u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_column(ColumnID{1}))[1], AllTypeVariant{"a"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{2}).get_column(ColumnID{0}))[0], AllTypeVariant{5});
+  EXPECT_EQ(ints->size(), 0u);
+  EXPECT_EQ(strings->size(), 0u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsTakesOverBuffersOfNewChunksOnly) {
+  Table table{2};
+  table.add_column("col_1", "int");
+  const auto values_of_chunk = [&](const ChunkID chunk_id) -> const ValueVector<int>& {
+    return std::static_pointer_cast<ValueColumn<int>>(table.get_chunk(chunk_id).get_column(ColumnID{0}))->values();
+  };
+
+  // the first chunk is already visible to readers, so the values are copied into it
+  auto first = std::make_shared<ValueColumn<int>>(std::vector<int>{1, 2});
+  const auto first_data = first->values().data();
+  table.append_columns({first});
+  EXPECT_NE(values_of_chunk(ChunkID{0}).data(), first_data);
+
+  // the second chunk is filled before it is added to the table and takes over the buffer
+  auto second = std::make_shared<ValueColumn<int>>(std::vector<int>{3, 4});
+  const auto second_data = second->values().data();
+  table.append_columns({second});
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(values_of_chunk(ChunkID{1}).data(), second_data);
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 2u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsIntoUnlimitedChunk) {
+  Table table;
+  table.add_column("col_1", "double");
+  table.append_columns({std::make_shared<ValueColumn<double>>(std::vector<double>{1.5, 2.5})});
+  table.append_columns({std::make_shared<ValueColumn<double>>(std::vector<double>{3.5})});
+
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsRejectsMismatchingColumns) {
+  auto ints = std::make_shared<ValueColumn<int>>(std::vector<int>{2, 3});
+  auto doubles = std::make_shared<ValueColumn<double>>(std::vector<double>{2.0, 3.0});
+  auto short_strings = std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"a"});
+
+  EXPECT_THROW(t.append_columns({ints}), std::exception);
+  EXPECT_THROW(t.append_columns({ints, doubles}), std::exception);
+  EXPECT_THROW(t.append_columns({ints, short_strings}), std::exception);
+  EXPECT_EQ(t.row_count(), 0u);
+}
+
+TEST_F(StorageTableTest, ConcurrentAppends) {
+  constexpr auto thread_count = 8;
+  constexpr auto rows_per_thread = 500;
+  Table table{100};
+  table.add_column("thread", "int");
+  table.add_column("row", "int");
+
+  std::vector<std::thread> writers;
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    writers.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < rows_per_thread / 2; ++row) {
+        table.append({thread_id, row});
+      }
+      auto threads = std::make_shared<ValueColumn<int>>(std::vector<int>(rows_per_thread / 2, thread_id));
+      auto rows = std::make_shared<ValueColumn<int>>();
+      for (auto row = rows_per_thread / 2; row < rows_per_thread; ++row) rows->values().push_back(row);
+      table.append_columns({threads, rows});
+    });
+  }
+
+  // concurrent readers must never see more rows than fit into a chunk, a shrinking table, or partially written rows.
+  // every writer appends its rows in order, so the rows of a writer that a reader sees have to be increasing.
+  uint64_t previous_row_count = 0;
+  for (auto i = 0; i < 100; ++i) {
+    const auto row_count = table.row_count();
+    EXPECT_GE(row_count, previous_row_count);
+    previous_row_count = row_count;
+
+    std::vector<int> last_row(thread_count, -1);
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      const auto chunk_size = chunk.size();
+      EXPECT_LE(chunk_size, 100u);
+      if (chunk_size == 0) continue;
+
+      std::vector<int> threads;
+      std::vector<int> rows;
+      for (ColumnID column_id{0}; column_id < 2; ++column_id) {
+        auto& values = column_id == 0 ? threads : rows;
+        const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(column_id));
+        create_iterable_from_column(*column, chunk_size).for_each([&](const auto& value) {
+          values.push_back(value.value());
+        });
+      }
+      ASSERT_EQ(threads.size(), chunk_size);
+      ASSERT_EQ(rows.size(), chunk_size);
+      for (ChunkOffset offset = 0; offset < chunk_size; ++offset) {
+        ASSERT_GE(threads[offset], 0);
+        ASSERT_LT(threads[offset], thread_count);
+        EXPECT_GT(rows[offset], last_row[threads[offset]]);
+        last_row[threads[offset]] = rows[offset];
+      }
+    }
+  }
+
+  for (auto& writer : writers) writer.join();
+
+  EXPECT_EQ(table.row_count(), static_cast<uint64_t>(thread_count * rows_per_thread));
+  EXPECT_EQ(table.chunk_count(), static_cast<ChunkID>(thread_count * rows_per_thread / 100));
+
+  // every thread's rows have been written completely and in order
+  std::vector<int> next_row(thread_count, 0);
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    const auto& threads = std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{0}))->values();
+    const auto& rows = std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{1}))->values();
+    ASSERT_EQ(threads.size(), chunk.size());
+    for (ChunkOffset offset = 0; offset < chunk.size(); ++offset) {
+      EXPECT_EQ(rows[offset], next_row[threads[offset]]++);
+    }
+  }
+}
+
+TEST_F(StorageTableTest, ReadStringsWhileAppending) {
+  constexpr auto row_count = 20'000;
+  Table table{10'000};
+  table.add_column("text", "string");
+
+  // the lengths of the strings vary, so that their characters outgrow the buffers that were reserved for them
+  const auto make_string = [](const int row) {
+    return std::string(static_cast<size_t>(row % 97), static_cast<char>('a' + row % 26));
+  };
+
+  std::atomic_bool done{false};
+  std::thread writer([&]() {
+    for (auto row = 0; row < row_count; ++row) {
+      table.append({make_string(row)});
+    }
+    done = true;
+  });
+
+  // the visible strings of the chunk that is appended to can be read at any time
+  while (!done) {
+    const auto chunk_id = ChunkID{table.chunk_count() - 1};
+    const auto& chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk.size();
+    const auto column = std::dynamic_pointer_cast<ValueColumn<std::string>>(chunk.get_column(ColumnID{0}));
+    ChunkOffset chunk_offset = 0;
+    create_iterable_from_column(*column, chunk_size).for_each([&](const auto& value) {
+      ASSERT_EQ(value.value(), make_string(static_cast<int>(chunk_id * 10'000 + chunk_offset)));
+      ++chunk_offset;
+    });
+    ASSERT_EQ(chunk_offset, chunk_size);
+  }
+  writer.join();
+
+  EXPECT_EQ(table.row_count(), static_cast<uint64_t>(row_count));
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  // full chunks become immutable as soon as inserts go to the next chunk
+  EXPECT_TRUE(t.get_chunk(ChunkID{0}).is_immutable());
+  EXPECT_FALSE(t.get_chunk(ChunkID{1}).is_immutable());
+
+  t.compress_chunk(ChunkID{0});
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1})), nullptr);
+  EXPECT_EQ(chunk.size(), 2u);
+  EXPECT_EQ((*chunk.get_column(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  // the last chunk still receives inserts
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}), std::exception);
+}
+
+TEST_F(StorageTableTest, EmplaceChunk) {
+  Table table{3};
+  table.add_column_definition("col_1", "int");
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{1, 2}));
+  table.emplace_chunk(chunk);
+
+  // the empty chunk the table was created with is replaced
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(&table.get_chunk(ChunkID{0}), chunk.get());
+  EXPECT_TRUE(chunk->statistics());
+  EXPECT_TRUE(chunk->is_immutable());
+
+  // emplaced chunks do not receive inserts
+  table.append({3});
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(chunk->size(), 2u);
+
+  auto wide_chunk = std::make_shared<Chunk>();
+  wide_chunk->add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{1, 2}));
+  wide_chunk->add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{1, 2}));
+  EXPECT_THROW(table.emplace_chunk(wide_chunk), std::logic_error);
+
+  auto double_chunk = std::make_shared<Chunk>();
+  double_chunk->add_column(std::make_shared<ValueColumn<double>>(std::vector<double>{1.5}));
+  EXPECT_THROW(table.emplace_chunk(double_chunk), std::logic_error);
+  EXPECT_EQ(table.chunk_count(), 2u);
+
+  // the partially filled last chunk is completed before the emplaced chunk is added behind it
+  auto second_chunk = std::make_shared<Chunk>();
+  second_chunk->add_column(std::make_shared<ValueColumn<int>>(std::vector<int>{4}));
+  table.emplace_chunk(second_chunk);
+  EXPECT_EQ(table.chunk_count(), 3u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{1}).is_immutable());
+  EXPECT_TRUE(table.get_chunk(ChunkID{1}).statistics());
+  EXPECT_EQ(&table.get_chunk(ChunkID{2}), second_chunk.get());
+}
+
+TEST_F(StorageTableTest, CompressChunkRethrowsErrors) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+  CountingMemoryResource memory_resource;
+  Table table{2, false, &memory_resource};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.append({3, "!"});
+
+  memory_resource.set_exhausted(true);
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}), std::bad_alloc);
+  memory_resource.set_exhausted(false);
+
+  // the chunk is left uncompressed and can be compressed later on
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  table.compress_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(StorageTableTest, CompressFullChunksInBackground) {
+  Table table{2, true};
+  table.add_column("col_1", "int");
+  table.append({4});
+  table.append({6});
+  table.append({3});
+  table.wait_for_compression();
+
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(table.get_chunk(ChunkID{0}).get_column(ColumnID{0})),
+            nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(ChunkID{1}).get_column(ColumnID{0})),
+            nullptr);
+  EXPECT_EQ(table.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, ChunksUseMemoryResource) {
+  CountingMemoryResource memory_resource;
+  {
+    Table table{2, false, &memory_resource};
+    EXPECT_EQ(table.memory_resource(), &memory_resource);
+    table.add_column("col_1", "int", true);
+    table.add_column("col_2", "string");
+    table.append({4, "Hello,"});
+    table.append({NULL_VALUE, "world"});
+    table.append({3, "!"});
+    table.append_columns({std::make_shared<ValueColumn<int>>(std::vector<int>{5}),
+                          std::make_shared<ValueColumn<std::string>>(std::vector<std::string>{"again"})});
+    EXPECT_GT(memory_resource.allocated_bytes(), 0u);
+
+    const auto& chunk = table.get_chunk(ChunkID{1});
+    EXPECT_EQ(chunk.get_allocator().resource(), &memory_resource);
+    const auto ints = std::dynamic_pointer_cast<ValueColumn<int>>(chunk.get_column(ColumnID{0}));
+    EXPECT_EQ(ints->values().get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(ints->null_values().words().get_allocator().resource(), &memory_resource);
+    const auto strings = std::dynamic_pointer_cast<ValueColumn<std::string>>(chunk.get_column(ColumnID{1}));
+    EXPECT_EQ(strings->values().get_allocator().resource(), &memory_resource);
+    EXPECT_EQ(strings->values()[1], "again");
+
+    table.compress_chunk(ChunkID{0});
+    const auto dictionary_column =
+        std::dynamic_pointer_cast<DictionaryColumn<int>>(table.get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+    ASSERT_NE(dictionary_column, nullptr);
+    EXPECT_EQ(dictionary_column->dictionary()->get_allocator().resource(), &memory_resource);
+  }
+
+  // everything has been returned to the resource once the table is gone
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsage) {
+  const auto empty_bytes = t.estimate_memory_usage();
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_GT(t.estimate_memory_usage(), empty_bytes);
+
+  // the table consists of its columns and some bookkeeping
+  const auto column_bytes = t.estimate_memory_usage(ColumnID{0}) + t.estimate_memory_usage(ColumnID{1});
+  EXPECT_GT(column_bytes, 0u);
+  EXPECT_GT(t.estimate_memory_usage(), column_bytes);
+  EXPECT_EQ(t.estimate_memory_usage(ColumnID{0}),
+            t.get_chunk(ChunkID{0}).get_column(ColumnID{0})->estimate_memory_usage() +
+                t.get_chunk(ChunkID{1}).get_column(ColumnID{0})->estimate_memory_usage());
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
 
 namespace opossum {
 
@@ -49,13 +50,82 @@ TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
 
 TEST_F(StorageValueColumnTest, ReturnsVectorValue) {
   vc_str.append("TestValue");
-  std::string result = boost::lexical_cast<std::string>(vc_str[0]);
+  std::string result = type_cast<std::string>(vc_str[0]);
   std::string expected = "TestValue";
   EXPECT_STREQ(result.c_str(), expected.c_str());
 }
 
+TEST_F(StorageValueColumnTest, ReturnsTypedValues) {
+  vc_int.append(3);
+  vc_int.append(1.5);
+
+  const auto& values = vc_int.values();
+  EXPECT_EQ(values.size(), 2u);
+  EXPECT_EQ(values[0], 3);
+  EXPECT_EQ(values[1], 1);
+}
+
+TEST_F(StorageValueColumnTest, ReservesCapacity) {
+  ValueColumn<std::string> vc_reserved{100};
+  EXPECT_EQ(vc_reserved.size(), 0u);
+  EXPECT_GE(vc_reserved.values().capacity(), 100u);
+}
+
 TEST_F(StorageValueColumnTest, ThrowsErrorForNonExistingValue) {
   EXPECT_THROW(vc_str[0], std::exception);
 }
 
+TEST_F(StorageValueColumnTest, NullableColumn) {
+  ValueColumn<int> vc_nullable{0, true};
+  vc_nullable.append(3);
+  vc_nullable.append(NULL_VALUE);
+  vc_nullable.append(5);
+
+  EXPECT_TRUE(vc_nullable.is_nullable());
+  EXPECT_EQ(vc_nullable.size(), 3u);
+  EXPECT_FALSE(vc_nullable.is_null(0));
+  EXPECT_TRUE(vc_nullable.is_null(1));
+  EXPECT_TRUE(variant_is_null(vc_nullable[1]));
+  EXPECT_EQ(vc_nullable[2], AllTypeVariant{5});
+  EXPECT_EQ(vc_nullable.null_values().null_count(), 1u);
+}
+
+TEST_F(StorageValueColumnTest, ThrowsErrorForNullInNonNullableColumn) {
+  EXPECT_FALSE(vc_int.is_nullable());
+  EXPECT_THROW(vc_int.append(NULL_VALUE), std::exception);
+  EXPECT_EQ(vc_int.size(), 0u);
+}
+
+TEST_F(StorageValueColumnTest, FailedCastLeavesColumnUnchanged) {
+  ValueColumn<int> vc_nullable{0, true};
+  vc_nullable.append(1);
+  EXPECT_THROW(vc_nullable.append("abc"), std::exception);
+  EXPECT_EQ(vc_nullable.size(), 1u);
+  EXPECT_EQ(vc_nullable.null_values().size(), 1u);
+}
+
+TEST_F(StorageValueColumnTest, CastValue) {
+  ValueColumn<int> vc_nullable{0, true};
+  EXPECT_EQ(vc_nullable.cast_value("2"), AllTypeVariant{2});
+  EXPECT_TRUE(variant_is_null(vc_nullable.cast_value(NULL_VALUE)));
+  EXPECT_THROW(vc_int.cast_value(NULL_VALUE), std::exception);
+  EXPECT_THROW(vc_int.cast_value("abc"), std::exception);
+  EXPECT_EQ(vc_nullable.size(), 0u);
+}
+
+TEST_F(StorageValueColumnTest, EstimateMemoryUsage) {
+  // reserved capacity is counted as well
+  ValueColumn<int> vc_reserved{100};
+  EXPECT_GE(vc_reserved.estimate_memory_usage(), sizeof(vc_reserved) + 100 * sizeof(int));
+
+  // strings count their characters
+  const auto empty_bytes = vc_str.estimate_memory_usage();
+  vc_str.append(std::string(1000, 'a'));
+  EXPECT_GE(vc_str.estimate_memory_usage(), empty_bytes + 1000);
+
+  // the null bitmap of nullable columns is counted
+  ValueColumn<int> vc_nullable{100, true};
+  EXPECT_GT(vc_nullable.estimate_memory_usage(), vc_reserved.estimate_memory_usage());
+}
+
 }  // namespace opossum